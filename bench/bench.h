@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file bench.h
+ * @brief Minimal self-contained benchmark harness for host builds.
+ *
+ * Usage:
+ * @code
+ * ELIB_BENCH("kernel/process_all")
+ * {
+ *   state.report("time", elib::bench::ns_per_op(100000, [] { elib::kernel::process_all(); }), "ns/op");
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace elib::bench
+{
+  using clock = std::chrono::steady_clock;
+
+  struct metric
+  {
+    std::string name;
+    double value;
+    std::string unit;
+  };
+
+  /**
+   * @brief Collects the metrics reported by one benchmark.
+   */
+  class context
+  {
+  public:
+    void report(std::string name, double value, std::string unit)
+    {
+      metrics_.push_back(metric{std::move(name), value, std::move(unit)});
+    }
+
+    const std::vector<metric>& metrics() const
+    {
+      return metrics_;
+    }
+
+  private:
+    std::vector<metric> metrics_;
+  };
+
+  using bench_function = void (*)(context&);
+
+  struct benchmark
+  {
+    const char* name;
+    bench_function function;
+  };
+
+  inline std::vector<benchmark>& registry()
+  {
+    static std::vector<benchmark> benchmarks;
+
+    return benchmarks;
+  }
+
+  struct registrar
+  {
+    registrar(const char* name, bench_function function)
+    {
+      registry().push_back(benchmark{name, function});
+    }
+  };
+
+  /**
+   * @brief Prevents the optimizer from discarding a computed value.
+   */
+  template<typename T>
+  inline void do_not_optimize(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  inline double elapsed_ns(clock::time_point start, clock::time_point stop)
+  {
+    return std::chrono::duration<double, std::nano>(stop - start).count();
+  }
+
+  /**
+   * @brief Runs `op` `iterations` times and returns the mean cost in nanoseconds.
+   */
+  template<typename Op>
+  double ns_per_op(std::size_t iterations, Op&& op)
+  {
+    const auto start = clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+      op();
+    const auto stop = clock::now();
+
+    return elapsed_ns(start, stop) / static_cast<double>(iterations);
+  }
+}
+
+#define ELIB_BENCH_CONCAT_IMPL(a, b) a##b
+#define ELIB_BENCH_CONCAT(a, b) ELIB_BENCH_CONCAT_IMPL(a, b)
+
+#define ELIB_BENCH_IMPL(function, name)                                                         \
+  static void function(::elib::bench::context& state);                                          \
+  static const ::elib::bench::registrar ELIB_BENCH_CONCAT(function, _registrar){name, &function}; \
+  static void function([[maybe_unused]] ::elib::bench::context& state)
+
+/**
+ * @brief Defines and registers a benchmark. The body receives `elib::bench::context& state`.
+ */
+#define ELIB_BENCH(name) ELIB_BENCH_IMPL(ELIB_BENCH_CONCAT(elib_bench_, __LINE__), name)
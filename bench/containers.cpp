@@ -0,0 +1,208 @@
+#include "bench.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <elib/array.h>
+#include <elib/circular_buffer.h>
+#include <elib/list.h>
+
+namespace
+{
+  constexpr std::size_t op_num = 1'000'000;
+  constexpr std::size_t capacity = 64;
+}
+
+ELIB_BENCH("circular_buffer/ops")
+{
+  elib::circular_buffer<std::uint32_t, capacity> buffer;
+  std::uint32_t value = 0;
+
+  state.report("push_pop", elib::bench::ns_per_op(op_num, [&] {
+    buffer.push_back(value++);
+    elib::bench::do_not_optimize(buffer.front());
+    buffer.pop_front();
+  }), "ns/op");
+
+  while (!buffer.full())
+    buffer.push_back(value++);
+
+  state.report("push_over", elib::bench::ns_per_op(op_num, [&] {
+    buffer.push_over(value++);
+    elib::bench::do_not_optimize(buffer.back());
+  }), "ns/op");
+
+  std::uint64_t sum = 0;
+  state.report("iterate", elib::bench::ns_per_op(op_num / capacity, [&] {
+    for (const std::uint32_t element : buffer)
+      sum += element;
+    elib::bench::do_not_optimize(sum);
+  }) / capacity, "ns/element");
+
+  state.report("insert_middle", elib::bench::ns_per_op(op_num / 10, [&] {
+    buffer.pop_back();
+    buffer.insert(std::next(buffer.cbegin(), capacity / 2), value++);
+  }), "ns/op");
+}
+
+namespace
+{
+  // full-ring iteration and indexing of a wrapped ring
+  template<std::size_t Capacity>
+  void report_access(elib::bench::context& state, const char* suffix)
+  {
+    elib::circular_buffer<std::uint32_t, Capacity> buffer;
+    for (std::uint32_t value = 0; value < Capacity / 2; ++value)
+      buffer.push_back(value);
+    buffer.erase_begin(Capacity / 2);
+    for (std::uint32_t value = 0; !buffer.full(); ++value)
+      buffer.push_back(value);
+
+    std::uint64_t sum = 0;
+    state.report(std::string{"iterate_"} + suffix, elib::bench::ns_per_op(op_num / Capacity, [&] {
+      for (const std::uint32_t element : buffer)
+        sum += element;
+      elib::bench::do_not_optimize(sum);
+    }) / Capacity, "ns/element");
+
+    state.report(std::string{"index_"} + suffix, elib::bench::ns_per_op(op_num / Capacity, [&] {
+      for (std::size_t index = 0; index < Capacity; ++index)
+        sum += buffer[index];
+      elib::bench::do_not_optimize(sum);
+    }) / Capacity, "ns/element");
+  }
+}
+
+ELIB_BENCH("circular_buffer/access")
+{
+  report_access<capacity>(state, "pow2");
+  report_access<capacity - 4>(state, "non_pow2");
+}
+
+namespace
+{
+  // moves `Block` bytes through a 4 KiB byte ring per round, element by element and in bulk
+  template<std::size_t Block>
+  void report_bulk(elib::bench::context& state)
+  {
+    constexpr std::size_t ring_size = 4096;
+    constexpr std::size_t round_num = op_num / Block + 1000;
+
+    elib::circular_buffer<std::uint8_t, ring_size> ring;
+    std::array<std::uint8_t, Block> in{};
+    std::array<std::uint8_t, Block> out{};
+
+    // keep the ring partially filled so blocks straddle the wrap now and then
+    for (std::size_t i = 0; i < ring_size / 3; ++i)
+      ring.push_back(static_cast<std::uint8_t>(i));
+
+    const auto bytes_per_second = [](double ns_per_round) { return Block / (ns_per_round * 1e-9); };
+
+    state.report("loop/" + std::to_string(Block), bytes_per_second(elib::bench::ns_per_op(round_num, [&] {
+      for (const std::uint8_t byte : in)
+        ring.push_back(byte);
+      for (std::uint8_t& byte : out)
+      {
+        byte = ring.front();
+        ring.pop_front();
+      }
+      elib::bench::do_not_optimize(out);
+    })), "bytes/s");
+
+    state.report("bulk/" + std::to_string(Block), bytes_per_second(elib::bench::ns_per_op(round_num, [&] {
+      ring.push_back_n(in.data(), Block);
+      ring.pop_front_n(out.data(), Block);
+      elib::bench::do_not_optimize(out);
+    })), "bytes/s");
+  }
+}
+
+ELIB_BENCH("circular_buffer/bulk")
+{
+  report_bulk<16>(state);
+  report_bulk<64>(state);
+  report_bulk<512>(state);
+  report_bulk<2048>(state);
+}
+
+namespace
+{
+  // an event owning a resource, default-constructible so the old eager storage builds it too
+  struct owning_event
+  {
+    std::uint32_t id{0};
+    std::string payload;
+  };
+}
+
+ELIB_BENCH("circular_buffer/construct")
+{
+  constexpr std::size_t event_num = 256;
+
+  state.report("owning_event/" + std::to_string(event_num), elib::bench::ns_per_op(op_num / 100, [&] {
+    elib::circular_buffer<owning_event, event_num> events;
+    elib::bench::do_not_optimize(events);
+  }), "ns/op");
+
+  state.report("owning_event/" + std::to_string(event_num) + "/push_pop", elib::bench::ns_per_op(op_num / 100, [&] {
+    elib::circular_buffer<owning_event, event_num> events;
+    events.push_back(owning_event{1, {}});
+    events.pop_front();
+    elib::bench::do_not_optimize(events);
+  }), "ns/op");
+}
+
+ELIB_BENCH("list/ops")
+{
+  elib::list<std::uint32_t, capacity> list;
+  std::uint32_t value = 0;
+
+  state.report("push_pop", elib::bench::ns_per_op(op_num, [&] {
+    list.push_back(value++);
+    elib::bench::do_not_optimize(list.front());
+    list.pop_front();
+  }), "ns/op");
+
+  while (list.size() < capacity)
+    list.push_back(value++);
+
+  std::uint64_t sum = 0;
+  state.report("iterate", elib::bench::ns_per_op(op_num / capacity, [&] {
+    for (const std::uint32_t element : list)
+      sum += element;
+    elib::bench::do_not_optimize(sum);
+  }) / capacity, "ns/element");
+
+  state.report("insert_erase_middle", elib::bench::ns_per_op(op_num / 10, [&] {
+    auto middle = std::next(list.begin(), capacity / 2);
+    middle = list.erase(middle);
+    list.insert(middle, value++);
+  }), "ns/op");
+}
+
+ELIB_BENCH("array/ops")
+{
+  elib::array<std::uint32_t, capacity> array;
+  std::uint32_t value = 0;
+
+  state.report("push_pop", elib::bench::ns_per_op(op_num, [&] {
+    array.push_back(value++);
+    elib::bench::do_not_optimize(array.back());
+    array.pop_back();
+  }), "ns/op");
+
+  while (!array.full())
+    array.push_back(value++);
+
+  std::uint64_t sum = 0;
+  state.report("iterate", elib::bench::ns_per_op(op_num / capacity, [&] {
+    for (const std::uint32_t element : array)
+      sum += element;
+    elib::bench::do_not_optimize(sum);
+  }) / capacity, "ns/element");
+
+  state.report("insert_erase_middle", elib::bench::ns_per_op(op_num / 10, [&] {
+    auto middle = array.erase(std::next(array.cbegin(), capacity / 2));
+    array.insert(middle, value++);
+  }), "ns/op");
+}
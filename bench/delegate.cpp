@@ -0,0 +1,90 @@
+#include "bench.h"
+
+#include <cstdint>
+#include <functional>
+#include <elib/callback.h>
+#include <elib/config.h>
+#include <elib/inplace_function.h>
+
+namespace
+{
+  constexpr std::size_t call_num = 10'000'000;
+  constexpr std::size_t set_num = 1'000'000;
+
+  using inplace_handler = elib::inplace_function<void(int), elib::event::config::handler_capacity>;
+
+  // four captured references: bigger than the std::function small buffer of common implementations
+  struct state_refs
+  {
+    std::int64_t sum{0};
+    std::int64_t count{0};
+    std::int64_t last{0};
+    std::int64_t max{0};
+  };
+
+  auto make_handler(state_refs& s)
+  {
+    return [&sum = s.sum, &count = s.count, &last = s.last, &max = s.max](int value) {
+      sum += value;
+      ++count;
+      last = value;
+      max = value > max ? value : max;
+    };
+  }
+
+  template<typename Delegate>
+  void report_call(elib::bench::context& state, Delegate& delegate)
+  {
+    int value = 0;
+    state.report("call", elib::bench::ns_per_op(call_num, [&] {
+      elib::bench::do_not_optimize(delegate); // keep the call indirect
+      delegate(value++);
+    }), "ns/call");
+  }
+
+  template<typename Delegate>
+  void report_set(elib::bench::context& state, state_refs& s)
+  {
+    Delegate delegate;
+    state.report("set", elib::bench::ns_per_op(set_num, [&] {
+      delegate = make_handler(s);
+      elib::bench::do_not_optimize(delegate);
+    }), "ns/set");
+  }
+
+  state_refs shared_state;
+  void plain_handler() { ++shared_state.count; }
+}
+
+ELIB_BENCH("delegate/std::function")
+{
+  state_refs s;
+  std::function<void(int)> delegate = make_handler(s);
+
+  report_call(state, delegate);
+  report_set<std::function<void(int)>>(state, s);
+  elib::bench::do_not_optimize(s);
+}
+
+ELIB_BENCH("delegate/inplace_function")
+{
+  state_refs s;
+  inplace_handler delegate = make_handler(s);
+
+  report_call(state, delegate);
+  report_set<inplace_handler>(state, s);
+  elib::bench::do_not_optimize(s);
+}
+
+ELIB_BENCH("delegate/callback")
+{
+  // elib::callback binds a free or member function, no captured state
+  elib::callback delegate;
+  delegate.connect<plain_handler>();
+
+  state.report("call", elib::bench::ns_per_op(call_num, [&] {
+    elib::bench::do_not_optimize(delegate);
+    delegate();
+  }), "ns/call");
+  elib::bench::do_not_optimize(shared_state);
+}
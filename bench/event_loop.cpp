@@ -0,0 +1,82 @@
+#include "bench.h"
+
+#include <cstdint>
+#include <elib/event_loop.h>
+
+namespace
+{
+  constexpr std::size_t queue_size = 256;
+  constexpr std::size_t round_num = 20000;
+
+  struct sample
+  {
+    std::int16_t x, y, z;
+  };
+
+  // queue a full block of samples, then time draining the loop
+  template<typename Loop>
+  double ns_per_event(Loop& loop)
+  {
+    std::int16_t value = 0;
+    double total_ns = 0.0;
+
+    for (std::size_t round = 0; round < round_num; ++round)
+    {
+      while (loop.push(sample{value, static_cast<std::int16_t>(value + 1), static_cast<std::int16_t>(value + 2)}))
+        ++value;
+
+      const auto start = elib::bench::clock::now();
+      while (!loop.empty())
+        loop.run();
+      total_ns += elib::bench::elapsed_ns(start, elib::bench::clock::now());
+    }
+
+    return total_ns / (round_num * queue_size);
+  }
+}
+
+ELIB_BENCH("event_loop/dispatch/per_event")
+{
+  elib::event_loop<sample, queue_size> loop;
+  loop.set_max_events_per_call(elib::event::config::max_event_per_call_num);
+
+  std::int32_t energy = 0;
+  loop.set_handler([&energy](const sample& s) {
+    energy += s.x * s.x + s.y * s.y + s.z * s.z;
+  });
+
+  state.report("time", ns_per_event(loop), "ns/event");
+  elib::bench::do_not_optimize(energy);
+}
+
+ELIB_BENCH("event_loop/dispatch/batch")
+{
+  elib::event_loop<sample, queue_size> loop;
+
+  std::int32_t energy = 0;
+  loop.set_batch_handler([&energy](elib::span<const sample> samples) {
+    for (const sample& s : samples)
+      energy += s.x * s.x + s.y * s.y + s.z * s.z;
+  });
+
+  state.report("time", ns_per_event(loop), "ns/event");
+  elib::bench::do_not_optimize(energy);
+}
+
+ELIB_BENCH("event_loop/push_run")
+{
+  // one event in, one event out, as seen from the kernel
+  elib::event_loop<sample, queue_size> loop;
+
+  std::int32_t energy = 0;
+  loop.set_handler([&energy](const sample& s) { energy += s.x; });
+
+  std::int16_t value = 0;
+  const double ns = elib::bench::ns_per_op(round_num * 10, [&] {
+    loop.push(sample{value++, 0, 0});
+    loop.run();
+  });
+
+  state.report("throughput", 1e9 / ns, "events/s");
+  elib::bench::do_not_optimize(energy);
+}
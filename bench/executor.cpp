@@ -0,0 +1,65 @@
+#include "bench.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <elib/host/executor.h>
+
+namespace
+{
+  constexpr std::size_t task_num = 64;
+  constexpr auto run_time = std::chrono::milliseconds{200};
+
+  // a CPU-bound slice of roughly a microsecond
+  class crunch_task : public elib::kernel::task_base
+  {
+  public:
+    void run() override
+    {
+      std::uint32_t hash = seed_;
+      for (unsigned i = 0; i < 256; ++i)
+        hash = (hash ^ i) * 16777619u;
+
+      seed_ = hash;
+      slices.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint64_t> slices{0};
+
+  private:
+    std::uint32_t seed_{2166136261u};
+  };
+
+  // slices per second of 64 independent tasks on `worker_num` workers
+  void executor_throughput(elib::bench::context& state, std::size_t worker_num)
+  {
+    std::array<crunch_task, task_num> tasks;
+    elib::host::executor executor{worker_num};
+
+    for (auto& task : tasks)
+      executor.add(task);
+
+    const auto start = elib::bench::clock::now();
+    executor.start();
+    std::this_thread::sleep_for(run_time);
+    executor.stop();
+    const auto stop = elib::bench::clock::now();
+
+    std::uint64_t slices = 0;
+    for (const auto& task : tasks)
+      slices += task.slices.load();
+
+    const std::string suffix = "/" + std::to_string(worker_num);
+    state.report("throughput" + suffix, static_cast<double>(slices) / (elib::bench::elapsed_ns(start, stop) * 1e-9), "slices/s");
+    state.report("steals" + suffix, static_cast<double>(executor.steal_count()), "tasks");
+  }
+}
+
+ELIB_BENCH("executor/workers")
+{
+  for (std::size_t worker_num : {1, 2, 4, 8, 16})
+    executor_throughput(state, worker_num);
+}
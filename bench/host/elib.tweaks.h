@@ -0,0 +1,7 @@
+#include <cstddef>
+
+namespace elib::kernel::config
+{
+  inline constexpr std::size_t max_task_num = 128;
+  inline constexpr std::size_t priority_levels = 8;
+}
@@ -0,0 +1,138 @@
+#include "bench.h"
+
+#include <array>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <elib/kernel.h>
+#include <elib/task.h>
+
+namespace
+{
+  constexpr std::size_t background_task_num = 64;
+  constexpr std::size_t trial_num = 20000;
+
+  // simulates a short housekeeping slice
+  class housekeeping_task : public elib::task
+  {
+  public:
+    void run() override
+    {
+      for (unsigned i = 0; i < 32; ++i)
+        elib::bench::do_not_optimize(i);
+    }
+  };
+
+  // an empty slice: measures the scheduler, not the work
+  class noop_task : public elib::task
+  {
+  public:
+    void run() override
+    {
+      elib::bench::do_not_optimize(this);
+    }
+  };
+
+  // Mean cost of one kernel::process_all() call with N ready tasks (timers idle).
+  template<std::size_t N>
+  void process_all_cost(elib::bench::context& state)
+  {
+    auto tasks = std::make_unique<std::array<noop_task, N>>();
+
+    state.report("tasks/" + std::to_string(N), elib::bench::ns_per_op(1'000'000, [] {
+      elib::kernel::process_all();
+    }), "ns/call");
+  }
+
+  // becomes runnable on start() and stops itself on the first slice
+  class urgent_task : public elib::manual_task
+  {
+  public:
+    using elib::manual_task::manual_task;
+
+    void run() override
+    {
+      ran_at = elib::bench::clock::now();
+      done = true;
+      stop();
+    }
+
+    elib::bench::clock::time_point ran_at{};
+    bool done{false};
+  };
+
+  // Worst-case time from an urgent task becoming runnable to its first slice,
+  // with 64 housekeeping tasks registered in the lowest band.
+  void dispatch_latency(elib::bench::context& state, elib::kernel::priority_type priority)
+  {
+    std::array<housekeeping_task, background_task_num> background;
+    urgent_task urgent{priority};
+
+    double worst_ns = 0.0;
+    double total_ns = 0.0;
+    std::size_t worst_dispatches = 0;
+
+    for (std::size_t trial = 0; trial < trial_num; ++trial)
+    {
+      // vary the round-robin position the urgent task arrives at
+      for (std::size_t i = 0; i < trial % background_task_num; ++i)
+        elib::kernel::process_tasks();
+
+      urgent.done = false;
+      urgent.start();
+      const auto ready_at = elib::bench::clock::now();
+
+      std::size_t dispatches = 0;
+      while (!urgent.done)
+      {
+        elib::kernel::process_tasks();
+        ++dispatches;
+      }
+
+      const double latency = elib::bench::elapsed_ns(ready_at, urgent.ran_at);
+      worst_ns = std::max(worst_ns, latency);
+      total_ns += latency;
+      worst_dispatches = std::max(worst_dispatches, dispatches);
+    }
+
+    state.report("worst_latency", worst_ns, "ns");
+    state.report("mean_latency", total_ns / static_cast<double>(trial_num), "ns");
+    state.report("worst_dispatches", static_cast<double>(worst_dispatches), "slices");
+  }
+}
+
+ELIB_BENCH("kernel/dispatch_latency/same_band")
+{
+  dispatch_latency(state, elib::kernel::default_priority);
+}
+
+ELIB_BENCH("kernel/dispatch_latency/high_priority")
+{
+  dispatch_latency(state, elib::kernel::config::priority_levels - 1);
+}
+
+ELIB_BENCH("kernel/process_all")
+{
+  process_all_cost<1>(state);
+  process_all_cost<8>(state);
+  process_all_cost<32>(state);
+  process_all_cost<elib::kernel::config::max_task_num>(state);
+}
+
+ELIB_BENCH("kernel/register_unregister")
+{
+  // a nearly full registry, the churning task lands in the last free slot
+  class churn_task : public elib::manual_task
+  {
+  public:
+    void run() override {}
+  };
+
+  auto tasks = std::make_unique<std::array<noop_task, elib::kernel::config::max_task_num - 1>>();
+  churn_task churn;
+
+  state.report("start_stop", elib::bench::ns_per_op(1'000'000, [&churn] {
+    churn.start();
+    churn.stop();
+  }), "ns/op");
+}
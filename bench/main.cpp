@@ -0,0 +1,78 @@
+#include "bench.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <elib/version.h>
+
+namespace
+{
+  // benchmark and metric names are plain ASCII, only quotes and backslashes need escaping
+  void print_json_string(const char* str)
+  {
+    std::putchar('"');
+    for (; *str; ++str)
+    {
+      if (*str == '"' || *str == '\\')
+        std::putchar('\\');
+      std::putchar(*str);
+    }
+    std::putchar('"');
+  }
+}
+
+// Usage: elib.bench [--json] [name-filter]
+int main(int argc, char** argv)
+{
+  bool json = false;
+  const char* filter = "";
+
+  for (int arg = 1; arg < argc; ++arg)
+  {
+    if (!std::strcmp(argv[arg], "--json"))
+      json = true;
+    else
+      filter = argv[arg];
+  }
+
+  if (json)
+    std::printf("{\n  \"version\": \"%s\",\n  \"benchmarks\": [", elib::version::str());
+
+  bool first = true;
+  for (const auto& benchmark : elib::bench::registry())
+  {
+    if (!std::strstr(benchmark.name, filter))
+      continue;
+
+    elib::bench::context state;
+    benchmark.function(state);
+
+    for (const auto& metric : state.metrics())
+    {
+      if (!json)
+      {
+        std::printf("%-48s %-24s %14.2f %s\n", benchmark.name, metric.name.c_str(), metric.value, metric.unit.c_str());
+        continue;
+      }
+
+      std::printf("%s\n    {\"name\": ", first ? "" : ",");
+      print_json_string(benchmark.name);
+      std::printf(", \"metric\": ");
+      print_json_string(metric.name.c_str());
+      if (std::isfinite(metric.value))
+        std::printf(", \"value\": %.4f, \"unit\": ", metric.value);
+      else
+        std::printf(", \"value\": null, \"unit\": ");
+      print_json_string(metric.unit.c_str());
+      std::printf("}");
+      first = false;
+    }
+
+    std::fflush(stdout);
+  }
+
+  if (json)
+    std::printf("\n  ]\n}\n");
+
+  return 0;
+}
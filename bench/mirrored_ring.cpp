@@ -0,0 +1,68 @@
+#include "bench.h"
+
+#include <array>
+#include <cstdint>
+#include <elib/circular_buffer.h>
+#include <elib/host/mirrored_ring.h>
+#include <elib/ring_stream.h>
+#include <elib/stream.h>
+
+namespace
+{
+  constexpr std::size_t ring_size = 64 * 1024;
+  constexpr std::size_t chunk_size = 1000; // not a multiple of the field size: fields straddle the wrap
+  constexpr std::size_t chunk_num = 1024;  // ~1 MB streamed per round
+  constexpr std::size_t round_num = 20;
+
+  using field = std::uint32_t;
+
+  // pushes a chunk, parses all complete fields and releases them, `chunk_num` times
+  template<typename Ring, typename Parse>
+  double stream_bytes_per_second(Ring& ring, Parse&& parse)
+  {
+    std::array<std::uint8_t, chunk_size> chunk{};
+    for (std::size_t i = 0; i < chunk.size(); ++i)
+      chunk[i] = static_cast<std::uint8_t>(i);
+
+    const double ns_per_round = elib::bench::ns_per_op(round_num, [&] {
+      for (std::size_t n = 0; n < chunk_num; ++n)
+      {
+        ring.push_back_n(chunk.data(), chunk.size());
+        ring.discard_front(parse(ring));
+      }
+    });
+
+    return chunk_size * chunk_num / (ns_per_round * 1e-9);
+  }
+}
+
+ELIB_BENCH("mirrored_ring/parse")
+{
+  static elib::circular_buffer<std::uint8_t, ring_size> two_segment;
+  state.report("circular_buffer+ring_input_stream", stream_bytes_per_second(two_segment, [](const auto& ring) {
+    elib::data::ring_input_stream in{ring};
+    field value{};
+    for (std::size_t i = ring.size() / sizeof(field); i; --i)
+    {
+      in >> value;
+      elib::bench::do_not_optimize(value);
+    }
+    return in.pos();
+  }), "bytes/s");
+
+  elib::host::mirrored_ring<ring_size> mirrored;
+  if (!mirrored)
+    return;
+
+  state.report("mirrored_ring+input_stream", stream_bytes_per_second(mirrored, [](const auto& ring) {
+    const auto bytes = ring.read_acquire();
+    elib::data::input_stream in{bytes.data(), bytes.size()};
+    field value{};
+    for (std::size_t i = bytes.size() / sizeof(field); i; --i)
+    {
+      in >> value;
+      elib::bench::do_not_optimize(value);
+    }
+    return in.pos();
+  }), "bytes/s");
+}
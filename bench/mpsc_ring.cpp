@@ -0,0 +1,108 @@
+#include "bench.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <elib/circular_buffer.h>
+#include <elib/mpsc_ring.h>
+
+namespace
+{
+  constexpr std::uint32_t message_num = 2'000'000; // total, split between the producers
+  constexpr std::size_t queue_size = 256;
+
+  // N producer threads -> one consumer thread, in messages per second.
+  template<typename Push, typename Pop>
+  double producers_throughput(std::uint32_t producer_num, Push push, Pop pop)
+  {
+    const std::uint32_t per_producer = message_num / producer_num;
+    const auto start = elib::bench::clock::now();
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t id = 0; id < producer_num; ++id)
+    {
+      producers.emplace_back([&push, per_producer] {
+        for (std::uint32_t next = 0; next < per_producer;)
+        {
+          if (push(next))
+            ++next;
+          else
+            std::this_thread::yield(); // queue full, let the consumer run on oversubscribed hosts
+        }
+      });
+    }
+
+    std::uint64_t checksum = 0;
+    for (std::uint32_t received = 0; received < per_producer * producer_num;)
+    {
+      if (pop(checksum))
+        ++received;
+      else
+        std::this_thread::yield();
+    }
+
+    for (std::thread& producer : producers)
+      producer.join();
+
+    const auto stop = elib::bench::clock::now();
+
+    elib::bench::do_not_optimize(checksum);
+    return static_cast<double>(per_producer * producer_num) / (elib::bench::elapsed_ns(start, stop) * 1e-9);
+  }
+
+  void mpsc_ring_throughput(elib::bench::context& state, std::uint32_t producer_num)
+  {
+    elib::mpsc_ring<std::uint32_t, queue_size> ring;
+
+    const double rate = producers_throughput(producer_num,
+      [&ring](std::uint32_t value) { return ring.push_back(value); },
+      [&ring](std::uint64_t& checksum) {
+        if (ring.empty())
+          return false;
+
+        checksum += ring.front();
+        ring.pop_front();
+        return true;
+      });
+
+    state.report("throughput/" + std::to_string(producer_num), rate, "msgs/s");
+  }
+
+  void mutex_throughput(elib::bench::context& state, std::uint32_t producer_num)
+  {
+    // circular_buffer is not thread-safe, the baseline guards it with a mutex
+    elib::circular_buffer<std::uint32_t, queue_size> buffer;
+    std::mutex mutex;
+
+    const double rate = producers_throughput(producer_num,
+      [&](std::uint32_t value) {
+        std::lock_guard<std::mutex> lock{mutex};
+        return buffer.push_back(value);
+      },
+      [&](std::uint64_t& checksum) {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (buffer.empty())
+          return false;
+
+        checksum += buffer.front();
+        buffer.pop_front();
+        return true;
+      });
+
+    state.report("throughput/" + std::to_string(producer_num), rate, "msgs/s");
+  }
+}
+
+ELIB_BENCH("mpsc_ring/producers")
+{
+  for (std::uint32_t producer_num : {1u, 2u, 4u, 8u})
+    mpsc_ring_throughput(state, producer_num);
+}
+
+ELIB_BENCH("mpsc_ring/producers/circular_buffer+mutex")
+{
+  for (std::uint32_t producer_num : {1u, 2u, 4u, 8u})
+    mutex_throughput(state, producer_num);
+}
@@ -0,0 +1,140 @@
+#include "bench.h"
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <elib/circular_buffer.h>
+#include <elib/spsc_ring.h>
+
+namespace
+{
+  constexpr std::uint32_t message_num = 2'000'000;
+  constexpr std::size_t queue_size = 256;
+  constexpr std::size_t batch_size = 32;
+
+  // Producer thread -> consumer thread throughput, in messages per second.
+  template<typename Push, typename Pop>
+  double two_thread_throughput(Push push, Pop pop)
+  {
+    const auto start = elib::bench::clock::now();
+
+    std::thread producer([&push] {
+      for (std::uint32_t next = 0; next < message_num;)
+      {
+        const std::uint32_t pushed = push(next);
+        if (!pushed)
+          std::this_thread::yield(); // queue full, let the consumer run on oversubscribed hosts
+
+        next += pushed;
+      }
+    });
+
+    std::uint64_t checksum = 0;
+    for (std::uint32_t received = 0; received < message_num;)
+    {
+      const std::uint32_t popped = pop(checksum);
+      if (!popped)
+        std::this_thread::yield();
+
+      received += popped;
+    }
+
+    producer.join();
+    const auto stop = elib::bench::clock::now();
+
+    elib::bench::do_not_optimize(checksum);
+    return static_cast<double>(message_num) / (elib::bench::elapsed_ns(start, stop) * 1e-9);
+  }
+}
+
+ELIB_BENCH("spsc_ring/two_thread/push_back")
+{
+  elib::spsc_ring<std::uint32_t, queue_size> ring;
+
+  const double rate = two_thread_throughput(
+    [&ring](std::uint32_t value) -> std::uint32_t { return ring.push_back(value) ? 1 : 0; },
+    [&ring](std::uint64_t& checksum) -> std::uint32_t {
+      if (ring.empty())
+        return 0;
+
+      checksum += ring.front();
+      ring.pop_front();
+      return 1;
+    });
+
+  state.report("throughput", rate, "msgs/s");
+}
+
+ELIB_BENCH("spsc_ring/two_thread/push_n")
+{
+  elib::spsc_ring<std::uint32_t, queue_size> ring;
+
+  const double rate = two_thread_throughput(
+    [&ring](std::uint32_t value) -> std::uint32_t {
+      std::array<std::uint32_t, batch_size> batch{};
+      const std::uint32_t count = std::min<std::uint32_t>(batch_size, message_num - value);
+      for (std::uint32_t i = 0; i < count; ++i)
+        batch[i] = value + i;
+
+      return static_cast<std::uint32_t>(ring.push_n(batch.data(), count));
+    },
+    [&ring](std::uint64_t& checksum) -> std::uint32_t {
+      std::array<std::uint32_t, batch_size> batch{};
+      const auto count = ring.pop_n(batch.data(), batch.size());
+      for (std::size_t i = 0; i < count; ++i)
+        checksum += batch[i];
+
+      return static_cast<std::uint32_t>(count);
+    });
+
+  state.report("throughput", rate, "msgs/s");
+}
+
+ELIB_BENCH("spsc_ring/two_thread/circular_buffer+mutex")
+{
+  // circular_buffer is not thread-safe, the baseline guards it with a mutex
+  elib::circular_buffer<std::uint32_t, queue_size> buffer;
+  std::mutex mutex;
+
+  const double rate = two_thread_throughput(
+    [&](std::uint32_t value) -> std::uint32_t {
+      std::lock_guard<std::mutex> lock{mutex};
+      return buffer.push_back(value) ? 1 : 0;
+    },
+    [&](std::uint64_t& checksum) -> std::uint32_t {
+      std::lock_guard<std::mutex> lock{mutex};
+      if (buffer.empty())
+        return 0;
+
+      checksum += buffer.front();
+      buffer.pop_front();
+      return 1;
+    });
+
+  state.report("throughput", rate, "msgs/s");
+}
+
+ELIB_BENCH("spsc_ring/single_thread/push_pop")
+{
+  elib::spsc_ring<std::uint32_t, queue_size> ring;
+  std::uint32_t value = 0;
+
+  state.report("time", elib::bench::ns_per_op(message_num, [&] {
+    ring.push_back(value++);
+    elib::bench::do_not_optimize(ring.front());
+    ring.pop_front();
+  }), "ns/msg");
+}
+
+ELIB_BENCH("circular_buffer/single_thread/push_pop")
+{
+  elib::circular_buffer<std::uint32_t, queue_size> buffer;
+  std::uint32_t value = 0;
+
+  state.report("time", elib::bench::ns_per_op(message_num, [&] {
+    buffer.push_back(value++);
+    elib::bench::do_not_optimize(buffer.front());
+    buffer.pop_front();
+  }), "ns/msg");
+}
@@ -0,0 +1,48 @@
+#include "bench.h"
+
+#include <array>
+#include <memory>
+#include <elib/kernel.h>
+#include <elib/static_schedule.h>
+#include <elib/task.h>
+
+namespace
+{
+  constexpr std::size_t call_num = 1'000'000;
+
+  // identical short slices, once dispatched virtually through the registry,
+  // once through the compile-time table
+  class counter_task : public elib::task
+  {
+  public:
+    using elib::task::task;
+
+    void run() override
+    {
+      ++count;
+      elib::bench::do_not_optimize(count);
+    }
+
+    unsigned count{0};
+  };
+
+  counter_task s0{elib::kernel::static_dispatch}, s1{elib::kernel::static_dispatch},
+               s2{elib::kernel::static_dispatch}, s3{elib::kernel::static_dispatch},
+               s4{elib::kernel::static_dispatch}, s5{elib::kernel::static_dispatch},
+               s6{elib::kernel::static_dispatch}, s7{elib::kernel::static_dispatch};
+
+  using schedule = elib::kernel::static_schedule<s0, s1, s2, s3, s4, s5, s6, s7>;
+}
+
+ELIB_BENCH("kernel/dispatch/registry_8")
+{
+  auto tasks = std::make_unique<std::array<counter_task, 8>>();
+
+  state.report("slice", elib::bench::ns_per_op(call_num, [] { elib::kernel::process_tasks(); }), "ns/slice");
+}
+
+ELIB_BENCH("kernel/dispatch/static_schedule_8")
+{
+  state.report("slice", elib::bench::ns_per_op(call_num, [] { schedule::process_tasks(); }), "ns/slice");
+  state.report("run_all", elib::bench::ns_per_op(call_num, [] { schedule::run_all(); }) / schedule::size(), "ns/slice");
+}
@@ -0,0 +1,280 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <elib/ring_stream.h>
+#include <elib/stream.h>
+
+namespace
+{
+  constexpr std::size_t round_num = 20000;
+  constexpr std::size_t buffer_size = 1024;
+
+  // (de)serializes a whole buffer per round, reported in bytes per second
+  template<typename Op>
+  double bytes_per_second(Op&& op)
+  {
+    const double ns_per_round = elib::bench::ns_per_op(round_num, op);
+    return buffer_size / (ns_per_round * 1e-9);
+  }
+
+  // telemetry frame: 40 fields, 256 bytes
+  struct frame
+  {
+    std::array<std::uint64_t, 8> counters;             // 64 bytes
+    std::array<std::uint32_t, 24> readings;            // 96 bytes
+    std::array<std::array<std::uint8_t, 12>, 8> names; // 96 bytes
+  };
+  ELIB_SERIALIZE(frame, counters, readings, names)
+
+  constexpr std::size_t frame_size = elib::data::serialized_max_size_v<frame>;
+  static_assert(frame_size == 256);
+
+  template<std::size_t... C, std::size_t... R, std::size_t... N>
+  bool write_frame(elib::data::output_stream& out, const frame& f,
+                   std::index_sequence<C...>, std::index_sequence<R...>, std::index_sequence<N...>)
+  {
+    return out.write_all(f.counters[C]..., f.readings[R]..., f.names[N]...);
+  }
+
+  template<std::size_t... C, std::size_t... R, std::size_t... N>
+  bool read_frame(elib::data::input_stream& in, frame& f,
+                  std::index_sequence<C...>, std::index_sequence<R...>, std::index_sequence<N...>)
+  {
+    return in.read_all(f.counters[C]..., f.readings[R]..., f.names[N]...);
+  }
+
+  using counter_index = std::make_index_sequence<8>;
+  using reading_index = std::make_index_sequence<24>;
+  using name_index = std::make_index_sequence<8>;
+}
+
+ELIB_BENCH("stream/frame256")
+{
+  frame source{};
+  for (std::size_t i = 0; i < source.readings.size(); ++i)
+    source.readings[i] = static_cast<std::uint32_t>(i * 2654435761u);
+
+  std::array<std::uint8_t, frame_size> buffer{};
+  frame decoded{};
+
+  // one bounds check and one copy per field
+  state.report("encode_per_field", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::output_stream out{buffer};
+    for (const auto value : source.counters)
+      out << value;
+    for (const auto value : source.readings)
+      out << value;
+    for (const auto& name : source.names)
+      out << name;
+    elib::bench::do_not_optimize(buffer);
+  }), "ns/frame");
+
+  // one bounds check for the whole frame
+  state.report("encode_write_all", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::output_stream out{buffer};
+    write_frame(out, source, counter_index{}, reading_index{}, name_index{});
+    elib::bench::do_not_optimize(buffer);
+  }), "ns/frame");
+
+  state.report("encode_reserve", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::output_stream out{buffer};
+    if (auto window = out.reserve(frame_size))
+    {
+      for (const auto value : source.counters)
+        window << value;
+      for (const auto value : source.readings)
+        window << value;
+      for (const auto& name : source.names)
+        window << name;
+    }
+    elib::bench::do_not_optimize(buffer);
+  }), "ns/frame");
+
+  state.report("encode_message", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::output_stream out{buffer};
+    out << source;
+    elib::bench::do_not_optimize(buffer);
+  }), "ns/frame");
+
+  state.report("decode_per_field", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::input_stream in{buffer};
+    for (auto& value : decoded.counters)
+      in >> value;
+    for (auto& value : decoded.readings)
+      in >> value;
+    for (auto& name : decoded.names)
+      in >> name;
+    elib::bench::do_not_optimize(decoded);
+  }), "ns/frame");
+
+  state.report("decode_read_all", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::input_stream in{buffer};
+    read_frame(in, decoded, counter_index{}, reading_index{}, name_index{});
+    elib::bench::do_not_optimize(decoded);
+  }), "ns/frame");
+
+  state.report("decode_message", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::input_stream in{buffer};
+    in >> decoded;
+    elib::bench::do_not_optimize(decoded);
+  }), "ns/frame");
+}
+
+ELIB_BENCH("stream/output")
+{
+  std::array<std::uint8_t, buffer_size> buffer{};
+
+  state.report("write_u8", bytes_per_second([&] {
+    elib::data::output_stream out{buffer};
+    for (std::size_t i = 0; i < buffer_size; ++i)
+      out << static_cast<std::uint8_t>(i);
+    elib::bench::do_not_optimize(buffer);
+  }), "bytes/s");
+
+  state.report("write_u32", bytes_per_second([&] {
+    elib::data::output_stream out{buffer};
+    for (std::uint32_t i = 0; i < buffer_size / sizeof(std::uint32_t); ++i)
+      out << i;
+    elib::bench::do_not_optimize(buffer);
+  }), "bytes/s");
+
+  std::array<std::uint8_t, 64> block{};
+  state.report("write_block64", bytes_per_second([&] {
+    elib::data::output_stream out{buffer};
+    for (std::size_t i = 0; i < buffer_size / block.size(); ++i)
+      out << block;
+    elib::bench::do_not_optimize(buffer);
+  }), "bytes/s");
+}
+
+ELIB_BENCH("stream/input")
+{
+  std::array<std::uint8_t, buffer_size> buffer{};
+  for (std::size_t i = 0; i < buffer_size; ++i)
+    buffer[i] = static_cast<std::uint8_t>(i);
+
+  state.report("read_u8", bytes_per_second([&] {
+    elib::data::input_stream in{buffer};
+    std::uint8_t value{};
+    for (std::size_t i = 0; i < buffer_size; ++i)
+    {
+      in >> value;
+      elib::bench::do_not_optimize(value);
+    }
+  }), "bytes/s");
+
+  state.report("read_u32", bytes_per_second([&] {
+    elib::data::input_stream in{buffer};
+    std::uint32_t value{};
+    for (std::size_t i = 0; i < buffer_size / sizeof(std::uint32_t); ++i)
+    {
+      in >> value;
+      elib::bench::do_not_optimize(value);
+    }
+  }), "bytes/s");
+
+  std::array<std::uint8_t, 64> block{};
+  state.report("read_block64", bytes_per_second([&] {
+    elib::data::input_stream in{buffer};
+    for (std::size_t i = 0; i < buffer_size / block.size(); ++i)
+    {
+      in >> block;
+      elib::bench::do_not_optimize(block);
+    }
+  }), "bytes/s");
+}
+
+ELIB_BENCH("stream/byte_order")
+{
+  std::array<std::uint8_t, buffer_size> buffer{};
+  constexpr std::uint32_t count = buffer_size / sizeof(std::uint32_t);
+
+  state.report("write_be_u32", bytes_per_second([&] {
+    elib::data::output_stream out{buffer};
+    for (std::uint32_t i = 0; i < count; ++i)
+      out.write_be(i);
+    elib::bench::do_not_optimize(buffer);
+  }), "bytes/s");
+
+  state.report("read_be_u32", bytes_per_second([&] {
+    elib::data::input_stream in{buffer};
+    std::uint32_t value{};
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+      in.read_be(value);
+      elib::bench::do_not_optimize(value);
+    }
+  }), "bytes/s");
+}
+
+ELIB_BENCH("stream/varint")
+{
+  // telemetry-like values: mostly small, a few wide ones
+  std::array<std::int32_t, 256> values{};
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    const std::int32_t small = static_cast<std::int32_t>(i % 100) - 50;
+    values[i] = (i % 16) ? small : static_cast<std::int32_t>(i * 2654435761u);
+  }
+
+  std::array<std::uint8_t, values.size() * elib::data::varint_max_size<std::int32_t>> buffer{};
+  std::size_t encoded = 0;
+
+  state.report("encode_i32", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::output_stream out{buffer};
+    for (const auto value : values)
+      out.write_varint(value);
+    encoded = out.pos();
+    elib::bench::do_not_optimize(buffer);
+  }) / values.size(), "ns/value");
+
+  state.report("decode_i32", elib::bench::ns_per_op(round_num, [&] {
+    elib::data::input_stream in{buffer.data(), encoded};
+    std::int32_t value{};
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      in.read_varint(value);
+      elib::bench::do_not_optimize(value);
+    }
+  }) / values.size(), "ns/value");
+
+  state.report("bytes_per_value", static_cast<double>(encoded) / values.size(), "bytes");
+}
+
+ELIB_BENCH("stream/ring")
+{
+  // a full ring wrapped in the middle, parsed as u32 fields
+  elib::circular_buffer<std::uint8_t, buffer_size> ring;
+  for (std::size_t i = 0; i < buffer_size / 2 + 1; ++i)
+    ring.push_back(0);
+  ring.erase_begin(buffer_size / 2 + 1);
+  while (!ring.full())
+    ring.push_back(static_cast<std::uint8_t>(ring.size()));
+
+  constexpr std::size_t count = buffer_size / sizeof(std::uint32_t);
+
+  std::array<std::uint8_t, buffer_size> scratch{};
+  state.report("linearize_read_u32", bytes_per_second([&] {
+    std::copy(ring.begin(), ring.end(), scratch.begin());
+    elib::data::input_stream in{scratch};
+    std::uint32_t value{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      in >> value;
+      elib::bench::do_not_optimize(value);
+    }
+  }), "bytes/s");
+
+  state.report("ring_read_u32", bytes_per_second([&] {
+    elib::data::ring_input_stream in{ring};
+    std::uint32_t value{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      in >> value;
+      elib::bench::do_not_optimize(value);
+    }
+  }), "bytes/s");
+}
@@ -0,0 +1,83 @@
+#include "bench.h"
+
+#include <memory>
+#include <elib/time/system_clock.h>
+#include "time/timer_engine.h"
+
+namespace
+{
+  using elib::time::config::timer_backend;
+  using elib::time::config::timer_catch_up;
+
+  constexpr std::size_t tick_num = 2000;
+
+  // NOTE: linear_scan fires at most one timer per tick, so with many timers it
+  //       falls behind (compare "fired") instead of getting slower per tick,
+  //       unless it fires every due timer ("linear_scan_all").
+
+  // Per-tick cost of servicing N periodic timers with spread intervals, and the
+  // cost of catching up when all N timers expire on the same tick.
+  template<timer_backend Backend, std::size_t N, bool FireAllDue = false>
+  void timer_dispatch(elib::bench::context& state)
+  {
+    using engine_type = elib::time::detail::timer_engine<Backend, N, timer_catch_up::skip, FireAllDue>;
+
+    auto engine = std::make_unique<engine_type>();
+    std::size_t fired = 0;
+
+    elib::time::system_clock::reset();
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      const auto id = engine->register_timer(std::chrono::milliseconds{50 + (i * 37) % 450}, [&fired] { ++fired; }, false);
+      engine->start(id);
+    }
+
+    // idle: nothing is due yet, the price every kernel::process_all() pays
+    state.report("idle", elib::bench::ns_per_op(100'000, [&engine] { engine->process_timers(); }), "ns/call");
+
+    // steady state: one process_timers() per tick, as driven by kernel::process_all()
+    const auto start = elib::bench::clock::now();
+    for (std::size_t tick = 0; tick < tick_num; ++tick)
+    {
+      elib::time::system_clock::increment();
+      engine->process_timers();
+    }
+    const auto stop = elib::bench::clock::now();
+
+    const double total_ns = elib::bench::elapsed_ns(start, stop);
+    state.report("tick", total_ns / static_cast<double>(tick_num), "ns/tick");
+    state.report("fired", static_cast<double>(fired), "timers");
+    state.report("per_fired", total_ns / static_cast<double>(fired), "ns/timer");
+
+    // catch-up: every timer is due, count calls until all of them fired
+    engine->unregister_timers();
+    elib::time::system_clock::reset();
+    for (std::size_t i = 0; i < N; ++i)
+      engine->start(engine->register_timer(std::chrono::milliseconds{10}, [&fired] { ++fired; }, true));
+
+    elib::time::system_clock::set(1000);
+    fired = 0;
+
+    std::size_t calls = 0;
+    const auto catchup_start = elib::bench::clock::now();
+    while (fired < N)
+    {
+      engine->process_timers();
+      ++calls;
+    }
+    const auto catchup_stop = elib::bench::clock::now();
+
+    state.report("catch_up", elib::bench::elapsed_ns(catchup_start, catchup_stop), "ns");
+    state.report("catch_up_calls", static_cast<double>(calls), "calls");
+  }
+}
+
+ELIB_BENCH("timer/linear_scan/10")       { timer_dispatch<timer_backend::linear_scan, 10>(state); }
+ELIB_BENCH("timer/linear_scan_all/10")   { timer_dispatch<timer_backend::linear_scan, 10, true>(state); }
+ELIB_BENCH("timer/min_heap/10")          { timer_dispatch<timer_backend::min_heap, 10>(state); }
+ELIB_BENCH("timer/linear_scan/100")      { timer_dispatch<timer_backend::linear_scan, 100>(state); }
+ELIB_BENCH("timer/linear_scan_all/100")  { timer_dispatch<timer_backend::linear_scan, 100, true>(state); }
+ELIB_BENCH("timer/min_heap/100")         { timer_dispatch<timer_backend::min_heap, 100>(state); }
+ELIB_BENCH("timer/linear_scan/1000")     { timer_dispatch<timer_backend::linear_scan, 1000>(state); }
+ELIB_BENCH("timer/linear_scan_all/1000") { timer_dispatch<timer_backend::linear_scan, 1000, true>(state); }
+ELIB_BENCH("timer/min_heap/1000")        { timer_dispatch<timer_backend::min_heap, 1000>(state); }
@@ -9,6 +9,7 @@
 //       in order to avoid conflicts between different header versions
 #pragma once
 
+#include <cassert>
 #include <cstddef>
 #include <array>
 #include <iterator>
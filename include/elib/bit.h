@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace elib
+{
+  // C++17 counterparts of C++20/23 <bit> facilities, mapped to compiler builtins
+  // where available (the portable fallbacks are recognized by optimizing compilers too)
+
+  enum class endian
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    little = 0,
+    big    = 1,
+    native = little
+#else
+    little = __ORDER_LITTLE_ENDIAN__,
+    big    = __ORDER_BIG_ENDIAN__,
+    native = __BYTE_ORDER__
+#endif
+  };
+
+  /**
+   * @brief Reverses the bytes of an integer (a single `bswap`/`rev` instruction where available).
+   */
+  template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+  constexpr T byteswap(T value) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    const U bits = static_cast<U>(value);
+
+    if constexpr (sizeof(T) == 1)
+    {
+      return value;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    else if constexpr (sizeof(T) == 2)
+    {
+      return static_cast<T>(__builtin_bswap16(bits));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+      return static_cast<T>(__builtin_bswap32(bits));
+    }
+    else if constexpr (sizeof(T) == 8)
+    {
+      return static_cast<T>(__builtin_bswap64(bits));
+    }
+#endif
+    else
+    {
+      U result{0};
+      for (std::size_t byte = 0; byte < sizeof(T); ++byte)
+        result = static_cast<U>(result | (((bits >> (8 * byte)) & 0xFFu) << (8 * (sizeof(T) - 1 - byte))));
+
+      return static_cast<T>(result);
+    }
+  }
+
+  /**
+   * @brief Number of consecutive zero bits starting from the least significant one.
+   */
+  template<typename T, typename = std::enable_if_t<std::is_unsigned_v<T>>>
+  constexpr int countr_zero(T value) noexcept
+  {
+    if (!value)
+      return std::numeric_limits<T>::digits;
+
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(T) <= sizeof(unsigned))
+      return __builtin_ctz(value);
+    else
+      return __builtin_ctzll(value);
+#else
+    int count = 0;
+    for (; !(value & 1u); value >>= 1)
+      ++count;
+
+    return count;
+#endif
+  }
+}
@@ -10,92 +10,61 @@
 #include <cstdint>
 #include <array>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
+#include <elib/span.h>
 
 namespace elib
 {
   namespace detail
   {
-    template<typename pointer>
-    constexpr void increment(pointer& it, pointer storage_begin, pointer storage_end)
+    /**
+     * @brief Reduces a slot index below 2 * Capacity into [0, Capacity): a single AND for
+     * power-of-two capacities, one compare otherwise (no division either way).
+     */
+    template<std::size_t Capacity, typename size_type>
+    constexpr size_type wrap(size_type index) noexcept
     {
-      if (++it == storage_end)
-        it = storage_begin;
+      if constexpr ((Capacity & (Capacity - 1)) == 0)
+        return index & (Capacity - 1);
+      else
+        return index < Capacity ? index : index - Capacity;
     }
 
-    template<typename pointer>
-    constexpr void decrement(pointer& it, pointer storage_begin, pointer storage_end)
+    /**
+     * @brief Copies (or moves) `count` elements between ring storage and a linear buffer.
+     * Trivially copyable elements take a single memmove, which also tolerates overlap.
+     * With `Construct` the destination slots are raw storage and the elements are
+     * constructed there instead of assigned.
+     */
+    template<bool Move, bool Construct = false, typename T, typename U>
+    void copy_elements(T* from, std::size_t count, U* to)
     {
-      if (it != storage_begin) {
-        --it;
-        return;
+      if constexpr (std::is_trivially_copyable_v<U>)
+      {
+        // memmove() with a null pointer is undefined even for zero elements
+        if (count)
+          std::memmove(static_cast<void*>(to), from, count * sizeof(U));
+      }
+      else if constexpr (Construct && Move)
+      {
+        std::uninitialized_move(from, from + count, to);
+      }
+      else if constexpr (Construct)
+      {
+        std::uninitialized_copy(from, from + count, to);
+      }
+      else if constexpr (Move)
+      {
+        std::move(from, from + count, to);
+      }
+      else
+      {
+        std::copy(from, from + count, to);
       }
-
-      it = storage_end - 1;
-    }
-
-    template<typename size_type>
-    constexpr void increment(size_type& index, size_type capacity)
-    {
-      if (++index == capacity)
-        index = 0;
-    }
-
-    template<typename size_type>
-    constexpr void decrement(size_type& index, size_type capacity)
-    {
-      index = index > 0 ? index - 1 : capacity - 1;
-    }
-
-    template<typename pointer, typename difference_type>
-    constexpr pointer add(pointer ptr, difference_type n, pointer storage_begin, pointer storage_end)
-    {
-      static_assert(std::is_pointer_v<pointer>, "circular_buffer::add (internal): Pointer must be a pointer type");
-
-      const auto availableAtEnd = storage_end - ptr;
-      if (availableAtEnd > static_cast<std::ptrdiff_t>(n))
-        return ptr + n;
-
-      const auto capacity = std::distance(storage_begin, storage_end);
-      return storage_begin + ((n - availableAtEnd) % capacity);
-    }
-
-    template<typename pointer, typename difference_type>
-    constexpr pointer sub(pointer ptr, difference_type n, pointer storage_begin, pointer storage_end)
-    {
-      static_assert(std::is_pointer_v<pointer>, "circular_buffer::sub (internal): Pointer must be a pointer type");
-
-      const auto capacity = std::distance(storage_begin, storage_end);
-      if (n > capacity)
-        n = n % capacity;
-
-      const auto availableAtFront = ptr - storage_begin;
-      if (availableAtFront >= n)
-        return ptr - n;
-
-      return storage_end - (n - availableAtFront);
-    }
-
-    template<typename size_type, typename difference_type>
-    constexpr size_type add(size_type index, difference_type n, size_type capacity)
-    {
-      const auto availableAtEnd = capacity - index;
-      if (availableAtEnd > n)
-        return index + n;
-
-      return ((n - availableAtEnd) % capacity);
-    }
-
-    template<typename size_type, typename difference_type>
-    constexpr size_type sub(size_type index, difference_type n, size_type capacity)
-    {
-      if (n > capacity)
-        n = n % capacity;
-
-      if (index >= n)
-        return index - n;
-
-      return capacity - (n - index);
     }
 
     template<typename Container>
@@ -158,9 +127,7 @@ namespace elib
 
       constexpr reference operator*() const
       {
-        auto ptr = detail::add(static_cast<pointer>(buffer_->first_), idx_,
-                               buffer_->storage_begin(), buffer_->storage_end());
-        return *(ptr);
+        return (*buffer_)[idx_];
       }
 
       constexpr pointer operator->() const { return &(operator*()); }
@@ -283,6 +250,14 @@ namespace elib
   /**
    * @brief A fixed-capacity circular buffer container.
    *
+   * Elements are addressed by their offset from the front slot. Power-of-two capacities
+   * wrap offsets with a single mask, which makes iteration and operator[] cheapest.
+   *
+   * Trivially copyable, default-constructible values live in a plain array. Any other
+   * value type (move-only, not default-constructible, owning resources) gets raw storage:
+   * an element is constructed on push and destroyed on pop, so an empty buffer costs no
+   * construction and a popped element releases its resources at once.
+   *
    * @tparam Value The type of elements stored in the buffer.
    * @tparam Capacity The maximum number of elements the buffer can hold.
    */
@@ -291,19 +266,60 @@ namespace elib
   {
     static_assert(Capacity > std::size_t{0}, "Capacity must be greater than zero");
 
-    using storage = std::array<Value, Capacity>;
+    // --- Storage Strategy ---
+    // Trivial values (bytes, PODs) keep a plain array: slots are always alive, so the
+    // in-place write_reserve() and memmove bulk copies work on them directly.
+    // Anything else uses a union (manual lifetime), only slots in [front, back] are alive.
+    static constexpr bool is_simple_value = std::is_trivially_copyable_v<Value> &&
+                                            std::is_default_constructible_v<Value>;
+
+    /// @brief Direct storage for trivial types.
+    struct direct_storage
+    {
+      Value values[Capacity]{};
+
+      template<typename... Args>
+      static void construct(Value* at, Args&&... args)
+      {
+        *at = Value(std::forward<Args>(args)...);
+      }
+
+      static void destroy(Value*) {} // No-op for trivial types
+    };
+
+    /// @brief Manual lifetime management for complex or non-default-constructible types.
+    struct manual_storage
+    {
+      union { Value values[Capacity]; }; // Anonymous union prevents default construction
+
+      manual_storage() {}  // Do nothing ctor
+      ~manual_storage() {} // Do nothing dtor
+
+      template<typename... Args>
+      static void construct(Value* at, Args&&... args)
+      {
+        ::new (static_cast<void*>(at)) Value(std::forward<Args>(args)...);
+      }
+
+      static void destroy(Value* at)
+      {
+        at->~Value();
+      }
+    };
+
+    using storage_type = std::conditional_t<is_simple_value, direct_storage, manual_storage>;
 
   public:
     using iterator       = detail::circular_buffer_iterator<circular_buffer, detail::nonconst_traits<circular_buffer>>;
     using const_iterator = detail::circular_buffer_iterator<const circular_buffer, detail::const_traits<circular_buffer>>;
 
-    using reference       = typename storage::reference;
-    using const_reference = typename storage::const_reference;
-    using pointer         = typename storage::pointer;
-    using const_pointer   = typename storage::const_pointer;
-    using value_type      = typename storage::value_type;
-    using difference_type = typename storage::difference_type;
-    using size_type       = typename storage::size_type;
+    using reference       = Value&;
+    using const_reference = const Value&;
+    using pointer         = Value*;
+    using const_pointer   = const Value*;
+    using value_type      = Value;
+    using difference_type = std::ptrdiff_t;
+    using size_type       = std::size_t;
 
     /**
      * @brief Default constructor. Initializes an empty buffer.
@@ -319,19 +335,14 @@ namespace elib
     }
 
     /**
-     * @brief Copy assignment operator.
+     * @brief Copy assignment operator. Copies only the stored elements, linearized.
      */
     circular_buffer& operator=(const circular_buffer& other) noexcept
     {
       if (this == &other)
         return *this;
 
-      // TODO: copy only initialized values
-      std::copy(other.data_.begin(), other.data_.end(), storage_begin());
-      size_ = other.size_;
-
-      first_ = storage_begin() + (other.first_ - other.storage_begin());
-      last_  = storage_begin() + (other.last_ - other.storage_begin());
+      assign<false>(other);
 
       return *this;
     }
@@ -345,24 +356,28 @@ namespace elib
     }
 
     /**
-     * @brief Move assignment operator.
+     * @brief Move assignment operator. Moves the stored elements one by one and leaves
+     * `other` empty.
      */
     circular_buffer& operator=(circular_buffer&& other) noexcept
     {
       if (this == &other)
         return *this;
 
-      clear();
-
-      std::swap(data_, other.data_);
-      std::swap(size_, other.size_);
-
-      first_ = storage_begin() + (other.first_ - other.storage_begin());
-      last_  = storage_begin() + (other.last_ - other.storage_begin());
+      assign<true>(other);
+      other.clear();
 
       return *this;
     }
 
+    /**
+     * @brief Destructor. Destroys the stored elements.
+     */
+    ~circular_buffer()
+    {
+      clear();
+    }
+
     /**
      * @brief Constructs the buffer with an initializer list.
      */
@@ -372,15 +387,7 @@ namespace elib
       if (il.size() > Capacity)
         return;
 
-      auto start = storage_begin();
-      for (auto&& value : il)
-      {
-        *start = std::move(value);
-        ++start;
-      }
-
-      size_ = il.size();
-      last_ = detail::add(last_, size_, storage_begin(), storage_end());
+      push_back_n(il.begin(), il.size());
     }
 
     /**
@@ -392,9 +399,8 @@ namespace elib
     {
       static_assert(N <= Capacity, "Array size more than container capacity");
 
-      size_ = N;
-      last_ = detail::add(last_, N, storage_begin(), storage_end());
-      std::copy(array, array + N, storage_begin());
+      for (const auto& value : array)
+        emplace_back(value);
     }
 
     /**
@@ -406,9 +412,7 @@ namespace elib
       if (!data || !size || size > Capacity)
         return;
 
-      size_ = size;
-      last_ = detail::add(last_, size, storage_begin(), storage_end());
-      std::copy(data, data + size, storage_begin());
+      push_back_n(data, size);
     }
 
     /**
@@ -464,7 +468,7 @@ namespace elib
      */
     constexpr reference front()
     {
-      return *first_;
+      return storage_begin()[first_];
     }
 
     /**
@@ -472,7 +476,7 @@ namespace elib
      */
     constexpr const_reference front() const
     {
-      return *first_;
+      return storage_begin()[first_];
     }
 
     /**
@@ -480,7 +484,7 @@ namespace elib
      */
     constexpr reference back()
     {
-      return *((last_ == storage_begin() ? storage_end() : last_) - 1);
+      return storage_begin()[slot(size_ - 1)];
     }
 
     /**
@@ -488,7 +492,23 @@ namespace elib
      */
     constexpr const_reference back() const
     {
-      return *((last_ == storage_begin() ? storage_end() : last_) - 1);
+      return storage_begin()[slot(size_ - 1)];
+    }
+
+    /**
+     * @brief Access the element at `index` from the front, unchecked.
+     */
+    constexpr reference operator[](size_type index)
+    {
+      return storage_begin()[slot(index)];
+    }
+
+    /**
+     * @brief Access the element at `index` from the front, unchecked (const).
+     */
+    constexpr const_reference operator[](size_type index) const
+    {
+      return storage_begin()[slot(index)];
     }
 
     /**
@@ -539,12 +559,21 @@ namespace elib
      */
     template<typename T>
     bool push_back(T&& value)
+    {
+      return emplace_back(std::forward<T>(value));
+    }
+
+    /**
+     * @brief Constructs an element in place at the end of the buffer.
+     * @return true if successful, false if buffer is full.
+     */
+    template<typename... Args>
+    bool emplace_back(Args&&... args)
     {
       if (full())
         return false;
 
-      *last_ = std::forward<T>(value);
-      detail::increment(last_, storage_begin(), storage_end());
+      construct(size_, std::forward<Args>(args)...);
       ++size_;
 
       return true;
@@ -559,8 +588,8 @@ namespace elib
       if (empty())
         return false;
 
-      detail::decrement(last_, storage_begin(), storage_end());
       --size_;
+      storage_type::destroy(storage_begin() + slot(size_));
 
       return true;
     }
@@ -587,10 +616,8 @@ namespace elib
       if (full())
         return false;
 
-      auto new_first = first_;
-      detail::decrement(new_first, storage_begin(), storage_end());
-      *new_first = std::forward<T>(value);
-      first_ = new_first;
+      first_ = slot(Capacity - 1);
+      construct(0, std::forward<T>(value));
       ++size_;
 
       return true;
@@ -605,8 +632,7 @@ namespace elib
       if (empty())
         return false;
 
-      detail::increment(first_, storage_begin(), storage_end());
-      --size_;
+      discard_front(1);
 
       return true;
     }
@@ -637,26 +663,37 @@ namespace elib
       if (index < elements_after)
       {
         // Closer to the front: shift front elements left
-        auto new_first = first_;
-        detail::decrement(new_first, storage_begin(), storage_end());
-        first_ = new_first;
+        first_ = slot(Capacity - 1);
         ++size_;
 
         auto target = std::next(begin(), index);
-        // Move the displaced front elements
-        std::move(std::next(begin()), std::next(target), begin());
+        if (index == 0)
+        {
+          construct(0, std::forward<T>(value));
+          return target;
+        }
+
+        // Move the displaced front elements, the new front slot is raw storage
+        construct(0, std::move((*this)[1]));
+        std::move(std::next(begin(), 2), std::next(target), std::next(begin()));
         *target = std::forward<T>(value);
         return target;
       }
       else
       {
         // Closer to the back: shift back elements right
-        detail::increment(last_, storage_begin(), storage_end());
         ++size_;
 
         auto target = std::next(begin(), index);
-        // Move the displaced back elements
-        std::move_backward(target, std::prev(end()), end());
+        if (index == static_cast<difference_type>(size_ - 1))
+        {
+          construct(size_ - 1, std::forward<T>(value));
+          return target;
+        }
+
+        // Move the displaced back elements, the new back slot is raw storage
+        construct(size_ - 1, std::move((*this)[size_ - 2]));
+        std::move_backward(target, std::prev(end(), 2), std::prev(end()));
         *target = std::forward<T>(value);
         return target;
       }
@@ -691,44 +728,248 @@ namespace elib
       }
     }
 
+    /**
+     * @brief Returns the contiguous run of elements starting at front().
+     * @note The run ends at the storage end, the rest (if any) starts at the storage begin.
+     */
+    span<value_type> array_one()
+    {
+      return {storage_begin() + first_, std::min<size_type>(size_, Capacity - first_)};
+    }
+
+    /**
+     * @brief Returns the contiguous run of elements starting at front() (const).
+     */
+    span<const value_type> array_one() const
+    {
+      return {storage_begin() + first_, std::min<size_type>(size_, Capacity - first_)};
+    }
+
+    /**
+     * @brief Returns the elements wrapped to the storage begin, following array_one().
+     * @note Empty unless the content wraps.
+     */
+    span<value_type> array_two()
+    {
+      return {storage_begin(), size_ - array_one().size()};
+    }
+
+    /**
+     * @brief Returns the elements wrapped to the storage begin, following array_one() (const).
+     */
+    span<const value_type> array_two() const
+    {
+      return {storage_begin(), size_ - array_one().size()};
+    }
+
+    /**
+     * @brief Appends up to `count` elements, in at most two contiguous copies.
+     * @return Number of elements actually pushed.
+     */
+    size_type push_back_n(const value_type* values, size_type count)
+    {
+      const size_type n = std::min(count, Capacity - size_);
+
+      // [tail, storage end) and [storage begin, ...)
+      const size_type tail = slot(size_);
+      const size_type first = std::min(n, Capacity - tail);
+      detail::copy_elements<false, true>(values, first, storage_begin() + tail);
+      detail::copy_elements<false, true>(values + first, n - first, storage_begin());
+
+      size_ += n;
+
+      return n;
+    }
+
+    /**
+     * @brief Moves up to `count` elements from the front into `values` and removes them.
+     * @return Number of elements actually popped.
+     */
+    size_type pop_front_n(value_type* values, size_type count)
+    {
+      const size_type n = transfer<true>(*this, 0, values, count);
+
+      return discard_front(n);
+    }
+
+    /**
+     * @brief Copies up to `count` elements starting `offset` places after the front,
+     * without removing them.
+     * @return Number of elements actually copied.
+     */
+    size_type copy_out(size_type offset, value_type* values, size_type count) const
+    {
+      return transfer<false>(*this, offset, values, count);
+    }
+
+    /**
+     * @brief Removes up to `count` elements from the front.
+     * @return Number of elements actually removed.
+     */
+    size_type discard_front(size_type count)
+    {
+      count = std::min(count, size_);
+
+      if constexpr (!is_simple_value)
+      {
+        for (size_type index = 0; index < count; ++index)
+          storage_type::destroy(storage_begin() + slot(index));
+      }
+
+      first_ = slot(count);
+      size_ -= count;
+
+      return count;
+    }
+
+    /**
+     * @brief Returns the largest contiguous run of free slots after back(), for a producer
+     * (e.g. DMA) writing into the storage in place. Publish the written elements with write_commit().
+     * @note Empty if the buffer is full. If the free space wraps, the rest becomes
+     * available once the first run is committed. An empty buffer always reserves its whole
+     * capacity. Only for trivially copyable values, the free slots hold no constructed elements.
+     */
+    span<value_type> write_reserve()
+    {
+      static_assert(std::is_trivially_copyable_v<Value>, "write_reserve() requires trivially copyable values");
+
+      // a drained ring leaves the front wherever the consumer stopped, rewind it so the
+      // free space is a single run again
+      if (empty())
+        first_ = 0;
+
+      const size_type tail = slot(size_);
+
+      return {storage_begin() + tail, std::min<size_type>(Capacity - size_, Capacity - tail)};
+    }
+
+    /**
+     * @brief Appends the first `count` elements written into the run returned by write_reserve().
+     * @return Number of elements actually appended (at most the free space).
+     */
+    size_type write_commit(size_type count)
+    {
+      static_assert(std::is_trivially_copyable_v<Value>, "write_commit() requires trivially copyable values");
+
+      count = std::min(count, Capacity - size_);
+      size_ += count;
+
+      return count;
+    }
+
+    /**
+     * @brief Returns the contiguous run of elements starting at front(), for a consumer
+     * reading the storage in place. Remove the consumed elements with read_release().
+     */
+    span<value_type> read_acquire()
+    {
+      return array_one();
+    }
+
+    /**
+     * @brief Returns the contiguous run of elements starting at front() (const).
+     */
+    span<const value_type> read_acquire() const
+    {
+      return array_one();
+    }
+
+    /**
+     * @brief Removes the first `count` elements of the run returned by read_acquire().
+     * @return Number of elements actually removed.
+     */
+    size_type read_release(size_type count)
+    {
+      return discard_front(count);
+    }
+
+    /**
+     * @brief Removes up to `count` elements from the front.
+     */
+    void erase_begin(size_type count)
+    {
+      discard_front(count);
+    }
+
     /**
      * @brief Clears the buffer.
      */
     void clear()
     {
-      size_  = 0;
-      first_ = last_ = storage_begin();
+      discard_front(size_);
+      first_ = 0;
     }
 
   private:
-    storage data_{};
-
-    pointer first_{data_.data()};
-    pointer last_{data_.data()};
+    storage_type storage_{};
 
+    // slot of front(), the element `index` places after it is at slot(index)
+    size_type first_{0};
     size_type size_{0};
 
     friend iterator;
     friend const_iterator;
 
+    constexpr size_type slot(size_type index) const noexcept
+    {
+      return detail::wrap<Capacity>(first_ + index);
+    }
+
+    // constructs the element `index` places after the front in its (raw) slot
+    template<typename... Args>
+    void construct(size_type index, Args&&... args)
+    {
+      storage_type::construct(storage_begin() + slot(index), std::forward<Args>(args)...);
+    }
+
+    // replaces the content with copies (or moves) of the elements of `other`, linearized
+    template<bool Move, typename Other>
+    void assign(Other& other)
+    {
+      clear();
+
+      const auto one = other.array_one();
+      const auto two = other.array_two();
+      detail::copy_elements<Move, true>(one.data(), one.size(), storage_begin());
+      detail::copy_elements<Move, true>(two.data(), two.size(), storage_begin() + one.size());
+
+      size_ = other.size_;
+    }
+
+    // copies or moves up to `count` elements from `offset` on: [slot, storage end) and [storage begin, ...)
+    template<bool Move, typename Self>
+    static size_type transfer(Self& self, size_type offset, value_type* values, size_type count)
+    {
+      if (offset >= self.size_)
+        return 0;
+
+      const size_type n = std::min(count, self.size_ - offset);
+      const size_type start = self.slot(offset);
+      const size_type first = std::min(n, Capacity - start);
+      detail::copy_elements<Move>(self.storage_begin() + start, first, values);
+      detail::copy_elements<Move>(self.storage_begin(), n - first, values + first);
+
+      return n;
+    }
+
     constexpr pointer storage_begin()
     {
-      return data_.data();
+      return storage_.values;
     }
 
     constexpr const_pointer storage_begin() const
     {
-      return data_.data();
+      return storage_.values;
     }
 
     constexpr pointer storage_end()
     {
-      return data_.data() + data_.size();
+      return storage_.values + Capacity;
     }
 
     constexpr const_pointer storage_end() const
     {
-      return data_.data() + data_.size();
+      return storage_.values + Capacity;
     }
   };
 }
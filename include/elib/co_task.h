@@ -0,0 +1,372 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file co_task.h
+ * @brief C++20 coroutine tasks resumed cooperatively by elib::kernel.
+ *
+ * A function returning elib::co_task is a kernel task written as straight-line code:
+ * every `co_await` ends the current slice. The coroutine starts on its first kernel
+ * slice and is resumed one step per slice after that.
+ *
+ * Awaitables:
+ * - `co_await elib::yield()`: gives the slice back, stays ready.
+ * - `co_await elib::time::sleep_for(interval)`: parks until the deadline, woken by an
+ *   elib::time::timer.
+ * - `co_await loop.next_event()`: parks until elib::event_loop `loop` has an event and
+ *   returns it (the loop's handlers stay idle for such a loop).
+ *
+ * A parked coroutine is out of the kernel ready set and costs no CPU until its timer
+ * or event wakes it.
+ *
+ * Frames come from a static pool of `kernel::config::coroutine_frame_num` blocks of
+ * `kernel::config::coroutine_frame_size` bytes, never from the heap. If the frame does
+ * not fit or the pool is empty the returned co_task is invalid (see valid()).
+ *
+ * @note Only available when the compiler supports coroutines (ELIB_HAS_COROUTINES).
+ *
+ * Usage Example:
+ * @code
+ * elib::co_task blink()
+ * {
+ *   for (;;)
+ *   {
+ *     hal::toggle_led();
+ *     co_await elib::time::sleep_for(std::chrono::milliseconds{500});
+ *   }
+ * }
+ *
+ * elib::co_task shell(elib::event_loop<char, 32>& rx)
+ * {
+ *   for (;;)
+ *   {
+ *     const char c = co_await rx.next_event();
+ *     ...
+ *   }
+ * }
+ *
+ * elib::co_task led = blink(); // runs from the next elib::kernel::process_all()
+ * @endcode
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define ELIB_HAS_COROUTINES 1
+#else
+#define ELIB_HAS_COROUTINES 0
+#endif
+
+#if ELIB_HAS_COROUTINES
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include <elib/assert.h>
+#include <elib/config.h>
+#include <elib/task.h>
+#include <elib/time/system_clock.h>
+#include <elib/time/timer.h>
+
+namespace elib
+{
+  namespace impl
+  {
+    // fixed-size blocks, released blocks are linked through their first bytes
+    template<std::size_t BlockSize, std::size_t BlockNum>
+    class frame_pool
+    {
+      static_assert(BlockSize >= sizeof(void*), "elib::co_task: coroutine_frame_size is too small");
+
+    public:
+      void* allocate(std::size_t size) noexcept
+      {
+        if (size > BlockSize)
+          return nullptr;
+
+        if (free_)
+        {
+          free_block* head = free_;
+          free_ = head->next;
+          --free_num_;
+          return head;
+        }
+
+        return used_ < BlockNum ? blocks_[used_++].data : nullptr;
+      }
+
+      void deallocate(void* frame) noexcept
+      {
+        free_ = ::new (frame) free_block{free_};
+        ++free_num_;
+      }
+
+      std::size_t available() const noexcept
+      {
+        return BlockNum - used_ + free_num_;
+      }
+
+    private:
+      struct free_block
+      {
+        free_block* next;
+      };
+
+      struct block
+      {
+        alignas(std::max_align_t) std::byte data[BlockSize];
+      };
+
+      std::array<block, BlockNum> blocks_{};
+      free_block* free_{nullptr};
+      std::size_t free_num_{0};
+      std::size_t used_{0}; // untouched blocks start here
+    };
+
+    inline frame_pool<kernel::config::coroutine_frame_size, kernel::config::coroutine_frame_num> co_frames;
+  }
+
+  /**
+   * @brief Owner of a coroutine driven by elib::kernel.
+   * The coroutine frame (and the kernel task inside it) is destroyed with the owner.
+   */
+  class co_task
+  {
+  public:
+    class promise_type;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    /**
+     * @brief Coroutine promise: the kernel task that resumes the coroutine.
+     * Lives in the coroutine frame, so its registry entry never moves.
+     */
+    class promise_type final : public task
+    {
+    public:
+      static void* operator new(std::size_t size) noexcept
+      {
+        return impl::co_frames.allocate(size);
+      }
+
+      static void operator delete(void* frame) noexcept
+      {
+        impl::co_frames.deallocate(frame);
+      }
+
+      static co_task get_return_object_on_allocation_failure() noexcept
+      {
+        return co_task{};
+      }
+
+      co_task get_return_object() noexcept
+      {
+        return co_task{handle_type::from_promise(*this)};
+      }
+
+      std::suspend_always initial_suspend() const noexcept { return {}; }
+      std::suspend_always final_suspend() const noexcept { return {}; }
+      void return_void() const noexcept {}
+
+      void unhandled_exception() const noexcept
+      {
+        ELIB_PANIC("elib::co_task: unhandled exception");
+      }
+
+      /**
+       * @brief Suspends the coroutine until `awaiter.await_ready()` holds.
+       * @param park true if a wake-up source (timer, event) will notify this task:
+       * it leaves the ready set until then. Otherwise the condition is polled every slice.
+       * @note For awaitables, call from await_suspend(). The awaiter must stay alive
+       * until resumed (it lives in the coroutine frame).
+       */
+      template<typename Awaiter>
+      void wait(const Awaiter& awaiter, bool park) noexcept
+      {
+        awaiter_ = &awaiter;
+        ready_ = [](const void* pending) { return static_cast<const Awaiter*>(pending)->await_ready(); };
+        parked_ = park;
+
+        if (park)
+          kernel::suspend(*this);
+      }
+
+      void run() override
+      {
+        const handle_type coroutine = handle_type::from_promise(*this);
+
+        // a wake-up may come early (timer period, shared notification): check first
+        const bool waiting = ready_ && !ready_(awaiter_);
+        if (coroutine.done() || waiting)
+        {
+          if (coroutine.done() || parked_)
+            kernel::suspend(*this);
+
+          return;
+        }
+
+        ready_ = nullptr;
+        coroutine.resume();
+
+        if (coroutine.done())
+          kernel::suspend(*this);
+      }
+
+    private:
+      bool (*ready_)(const void*){nullptr};
+      const void* awaiter_{nullptr};
+      bool parked_{false};
+    };
+
+    /**
+     * @brief Constructs an invalid task (no coroutine).
+     */
+    co_task() noexcept = default;
+
+    ~co_task()
+    {
+      destroy();
+    }
+
+    co_task(const co_task&) = delete;
+    co_task& operator=(const co_task&) = delete;
+
+    co_task(co_task&& other) noexcept
+      : coroutine_{std::exchange(other.coroutine_, nullptr)}
+    {
+    }
+
+    co_task& operator=(co_task&& other) noexcept
+    {
+      if (this != &other)
+      {
+        destroy();
+        coroutine_ = std::exchange(other.coroutine_, nullptr);
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Checks if the task owns a coroutine (false if no frame could be allocated).
+     */
+    bool valid() const noexcept
+    {
+      return static_cast<bool>(coroutine_);
+    }
+
+    explicit operator bool() const noexcept
+    {
+      return valid();
+    }
+
+    /**
+     * @brief Checks if the coroutine has run to completion.
+     * @pre valid()
+     */
+    bool done() const noexcept
+    {
+      return coroutine_.done();
+    }
+
+    /**
+     * @brief Number of free coroutine frames in the static pool.
+     */
+    static std::size_t frames_available() noexcept
+    {
+      return impl::co_frames.available();
+    }
+
+  private:
+    explicit co_task(handle_type coroutine) noexcept
+      : coroutine_{coroutine}
+    {
+    }
+
+    void destroy() noexcept
+    {
+      if (coroutine_)
+        std::exchange(coroutine_, nullptr).destroy();
+    }
+
+    handle_type coroutine_{nullptr};
+  };
+
+  /**
+   * @brief Awaitable of elib::yield().
+   */
+  struct yield_awaiter
+  {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<>) const noexcept {}
+    void await_resume() const noexcept {}
+  };
+
+  /**
+   * @brief Ends the current slice, the coroutine stays ready (round-robin).
+   */
+  inline yield_awaiter yield() noexcept
+  {
+    return {};
+  }
+
+  namespace time
+  {
+    /**
+     * @brief Awaitable of elib::time::sleep_for().
+     * The deadline counts from construction, an elib::time::timer wakes the coroutine.
+     */
+    class sleep_awaiter
+    {
+    public:
+      explicit sleep_awaiter(config::time_interval interval)
+        : deadline_{system_clock::duration_from_now(std::chrono::ceil<system_clock::duration>(interval))}
+        , interval_{interval}
+      {
+      }
+
+      sleep_awaiter(const sleep_awaiter&) = delete;
+      sleep_awaiter& operator=(const sleep_awaiter&) = delete;
+
+      bool await_ready() const noexcept
+      {
+        return system_clock::has_passed(deadline_);
+      }
+
+      void await_suspend(co_task::handle_type coroutine)
+      {
+        co_task::promise_type& promise = coroutine.promise();
+
+        // unregistered with the awaiter; without a free timer the deadline is polled
+        timer_ = timer::register_timer(interval_, promise);
+        timer_.start();
+
+        promise.wait(*this, timer_.valid());
+      }
+
+      void await_resume() const noexcept {}
+
+    private:
+      system_clock::duration_from deadline_;
+      config::time_interval interval_;
+      timer timer_;
+    };
+
+    /**
+     * @brief Suspends the calling elib::co_task for at least `interval`.
+     */
+    inline sleep_awaiter sleep_for(config::time_interval interval)
+    {
+      return sleep_awaiter{interval};
+    }
+  }
+}
+
+#endif
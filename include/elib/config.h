@@ -8,12 +8,36 @@
 #pragma once
 
 #include <cstdlib>
+#include <cstdint>
 #include <chrono>
 
 namespace elib
 {
   namespace time::config
   {
+    // Timer engine backends:
+    // - linear_scan: process_timers() scans all timers and fires at most one per call
+    //                (every due one with fire_all_due_timers)
+    // - min_heap:    active timers are ordered by absolute expiry tick, process_timers()
+    //                fires every due timer and the earliest deadline is known in O(1)
+    enum class timer_backend
+    {
+      linear_scan,
+      min_heap
+    };
+
+    // Periodic timers are rescheduled from their previous deadline (no drift). A timer
+    // that missed whole periods (e.g. after a stall) catches up according to:
+    // - skip:      fires once, the missed periods are dropped, the period grid is kept
+    // - fire_once: fires once and restarts its period from the current tick
+    // - fire_all:  fires once per missed period within the same process_timers() call
+    enum class timer_catch_up
+    {
+      skip,
+      fire_once,
+      fire_all
+    };
+
     namespace defaults
     {
       // System clock configuration (1 ms. clock by default)
@@ -24,6 +48,15 @@ namespace elib
       using time_interval = std::chrono::milliseconds;
 
       inline constexpr std::size_t max_timer_num = 10;     // maximum active registered timers
+      inline constexpr timer_backend timer_backend_type = timer_backend::linear_scan;
+      inline constexpr timer_catch_up timer_catch_up_policy = timer_catch_up::skip;
+
+      // linear_scan: fire every due timer per process_timers() call instead of one
+      // (min_heap always does)
+      inline constexpr bool fire_all_due_timers = false;
+
+      // Inline storage (bytes) of a timer callback, a bigger capture is a compile error
+      inline constexpr std::size_t timer_callback_capacity = 32;
     }
 
     using namespace defaults;
@@ -31,14 +64,57 @@ namespace elib
 
   namespace event::config
   {
-    inline constexpr std::size_t max_event_loop_num = 10;    // maximum active registered event loops
-    inline constexpr std::size_t max_event_per_call_num = 25; // maximum amount of events that can be 
-                                                          // processed during at a time
+    namespace defaults
+    {
+      inline constexpr std::size_t max_event_loop_num = 10;    // maximum active registered event loops
+      inline constexpr std::size_t max_event_per_call_num = 25; // maximum amount of events that can be 
+                                                            // processed during at a time
+
+      // Inline storage (bytes) of an event handler, a bigger capture is a compile error
+      inline constexpr std::size_t handler_capacity = 32;
+
+      // Alignment of the producer and consumer counters of spsc_ring/mpsc_ring. On multi-core
+      // hosts a cache line apart, so a push does not invalidate the line the consumer polls;
+      // single-core MCUs keep the natural alignment and save the padding.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86) || \
+    defined(__aarch64__) || defined(_M_ARM64)
+      inline constexpr std::size_t ring_counter_alignment = 64;
+#else
+      inline constexpr std::size_t ring_counter_alignment = alignof(std::size_t);
+#endif
+    }
+
+    using namespace defaults;
   }
 
   namespace kernel::config
   {
-    inline constexpr std::size_t max_task_num = 10; // maximum active registered tasks
+    namespace defaults
+    {
+      inline constexpr std::size_t max_task_num = 10; // maximum active registered tasks
+
+      // Number of task priority bands (at most 32). With a single band the kernel
+      // is a plain round-robin scheduler; with more bands the highest non-empty
+      // band is always served first (round-robin inside a band).
+      inline constexpr std::size_t priority_levels = 1;
+
+      // Per-task runtime statistics (kernel::visit_stats), compiled out when disabled.
+      inline constexpr bool task_stats = false;
+
+      // Execution time source of the statistics, same interface as the time::core_clock
+      // CycleCounter (`static std::uint32_t get() noexcept`). `void` counts system_clock ticks.
+      using task_stats_counter = void;
+
+      // A slice longer than this many counter ticks is counted as an overrun (0 = off).
+      inline constexpr std::uint32_t task_slice_budget = 0;
+
+      // Static frame pool of elib::co_task coroutines (C++20): a coroutine whose frame
+      // exceeds `coroutine_frame_size` bytes or finds the pool empty is not created.
+      inline constexpr std::size_t coroutine_frame_size = 256;
+      inline constexpr std::size_t coroutine_frame_num = 4;
+    }
+
+    using namespace defaults;
   }
 }
 
@@ -14,10 +14,16 @@
  * themselves to the central Kernel registry.
  *
  * Key Features:
- * - **Zero Dynamic Allocation**: Uses static arrays and circular buffers.
+ * - **Zero Dynamic Allocation**: Uses static arrays, circular buffers and inline handlers
+ *   (`elib::inplace_function`, sized by `event::config::handler_capacity`).
+ * - **Pluggable Queue**: `elib::spsc_ring` gives a lock-free single producer (ISR or thread),
+ *   `elib::mpsc_ring` lets several ISRs/tasks push without a critical section.
  * - **Automatic Registration**: Inherits from elib::task; registers on construction, unregisters on destruction.
  * - **Move Semantics**: Safe to return EventLoops from factory functions (Kernel registry is auto-updated).
  * - **Tunable Scheduling**: Supports processing single events (latency focus) or event bursts (throughput focus).
+ * - **Batch Dispatch**: A batch handler receives the queued events as contiguous spans (block processing).
+ * - **Zero Idle Cost**: An empty loop suspends itself and is woken by `push()` (see elib::kernel::notify).
+ * - **Coroutines**: An elib::co_task can `co_await loop.next_event()` instead of installing handlers (C++20).
  *
  * Usage Example:
  * @code
@@ -33,7 +39,12 @@
  * // 2. Optional: Allow processing up to 5 events per kernel tick to clear bursts
  * motorLoop.set_max_events_per_call(5);
  *
- * // 3. Push Event (safe from ISR)
+ * // Alternative: take whole blocks of events, at most two spans per kernel tick
+ * motor_loop.set_batch_handler([](elib::span<const motor_event> events) {
+ * hal::set_pwm(events.back().speed);
+ * });
+ *
+ * // 3. Push Event (from ISRs/threads: declare the loop with elib::spsc_ring or elib::mpsc_ring)
  * motorLoop.push({100});
  * }
  * @endcode
@@ -43,9 +54,14 @@
 
 #include <elib/task.h>
 #include <elib/circular_buffer.h>
+#include <elib/spsc_ring.h>
+#include <elib/mpsc_ring.h>
+#include <elib/span.h>
+#include <elib/inplace_function.h>
+#include <elib/co_task.h>
 #include <elib/config.h> // for maxEventPerCallNum
-#include <functional>
 #include <algorithm> // for std::clamp
+#include <atomic>
 
 namespace elib
 {
@@ -53,13 +69,18 @@ namespace elib
    * @brief A type-safe event queue and processor.
    * * @tparam Event The type of data to store in the queue.
    * @tparam EventQueueSize The capacity of the internal static buffer.
+   * @tparam Queue The queue template: `circular_buffer` (default), `spsc_ring` for a
+   * lock-free ISR/thread producer or `mpsc_ring` for several lock-free producers.
+   * `push_over()` is only available with `circular_buffer`.
    */
-  template<typename Event, std::size_t EventQueueSize>
+  template<typename Event, std::size_t EventQueueSize,
+           template<typename, std::size_t> class Queue = circular_buffer>
   class event_loop final : public elib::task
   {
   public:
     using event_type = Event;
-    using handler_type = std::function<void(const Event&)>;
+    using handler_type = inplace_function<void(const Event&), event::config::handler_capacity>;
+    using batch_handler_type = inplace_function<void(span<const Event>), event::config::handler_capacity>;
 
     /**
      * @brief Constructs an EventLoop and registers it with the elib::kernel.
@@ -67,6 +88,23 @@ namespace elib
      */
     event_loop() = default;
 
+    /**
+     * @brief Constructs an EventLoop registered in the given kernel priority band.
+     */
+    explicit event_loop(kernel::priority_type priority)
+      : task(priority)
+    {
+    }
+
+    /**
+     * @brief Constructs an EventLoop dispatched by an elib::kernel::static_schedule
+     * instead of the kernel registry.
+     */
+    explicit event_loop(kernel::static_dispatch_t tag)
+      : task(tag)
+    {
+    }
+
     // --------------------------------------------------------
     // Move Semantics
     // --------------------------------------------------------
@@ -79,7 +117,9 @@ namespace elib
     event_loop(event_loop&& other) noexcept 
       : task(std::move(other))
       , handler_(std::move(other.handler_))
+      , batch_handler_(std::move(other.batch_handler_))
       , max_events_per_call_(other.max_events_per_call_)
+      , awaited_(other.awaited_)
       , events_(std::move(other.events_))
     {
     }
@@ -94,7 +134,9 @@ namespace elib
       {
         task::operator=(std::move(other));
         handler_ = std::move(other.handler_);
+        batch_handler_ = std::move(other.batch_handler_);
         max_events_per_call_ = other.max_events_per_call_;
+        awaited_ = other.awaited_;
         events_ = std::move(other.events_);
       }
       return *this;
@@ -107,7 +149,7 @@ namespace elib
     /**
      * @brief Sets the callback to be executed when an event is processed.
      * @param handler The function to call. 
-     * @note If `nullptr` (or empty std::function) is passed, a default no-op handler 
+     * @note If `nullptr` (or an empty handler) is passed, a default no-op handler 
      * is set to prevent runtime crashes.
      */
     void set_handler(handler_type handler)
@@ -115,6 +157,19 @@ namespace elib
       handler_ = handler ? std::move(handler) : empty_handler;
     }
 
+    /**
+     * @brief Sets the callback that consumes queued events block-wise.
+     * * Every `run()` passes the events queued so far as contiguous spans straight from
+     * the queue storage (at most two when the queue wraps), without moving single events.
+     * The events are consumed once the handler returns.
+     * @param handler The function to call, `nullptr` restores per-event dispatch via `set_handler()`.
+     * @note `max_events_per_call()` does not apply to batch dispatch.
+     */
+    void set_batch_handler(batch_handler_type handler)
+    {
+      batch_handler_ = std::move(handler);
+    }
+
     /**
      * @brief Configures the "Burst Mode" for this loop.
      * * Controls how many events are popped and processed during a single execution
@@ -142,21 +197,21 @@ namespace elib
     // --------------------------------------------------------
 
     /**
-     * @brief Pushes an event into the queue.
+     * @brief Pushes an event into the queue and marks the loop ready.
      * @return true if successful, false if the queue is full.
      */
     bool push(const Event& event)
     {
-      return events_.push_back(event);
+      return notify_if(events_.push_back(event));
     }
 
     /**
-     * @brief Pushes an event into the queue (Move semantics).
+     * @brief Pushes an event into the queue and marks the loop ready (Move semantics).
      * @return true if successful, false if the queue is full.
      */
     bool push(Event&& event)
     {
-      return events_.push_back(std::move(event));
+      return notify_if(events_.push_back(std::move(event)));
     }
 
     /**
@@ -165,6 +220,7 @@ namespace elib
     void push_over(const Event& event)
     {
       events_.push_over(event);
+      wake();
     }
 
     /**
@@ -173,6 +229,7 @@ namespace elib
     void push_over(Event&& event)
     {
       events_.push_over(std::move(event));
+      wake();
     }
 
     /**
@@ -188,20 +245,119 @@ namespace elib
     std::size_t size() const { return events_.size(); }
     std::size_t capacity() const { return events_.capacity(); }
 
+#if ELIB_HAS_COROUTINES
+    // --------------------------------------------------------
+    // Coroutine Access
+    // --------------------------------------------------------
+
+    /**
+     * @brief Awaitable of next_event(): parks the coroutine until the queue has an event.
+     */
+    class event_awaiter
+    {
+    public:
+      explicit event_awaiter(event_loop& loop)
+        : loop_{loop}
+      {
+      }
+
+      event_awaiter(const event_awaiter&) = delete;
+      event_awaiter& operator=(const event_awaiter&) = delete;
+
+      ~event_awaiter()
+      {
+        release();
+      }
+
+      bool await_ready() const noexcept
+      {
+        return !loop_.events_.empty();
+      }
+
+      void await_suspend(co_task::handle_type coroutine)
+      {
+        co_task::promise_type& promise = coroutine.promise();
+
+        ELIB_ASSERT(!loop_.waiter_.load(), "elib::event_loop: the loop is already awaited by another coroutine");
+
+        promise.wait(*this, true);
+        loop_.waiter_.store(&promise);
+        waiting_ = true;
+
+        // an event pushed before the waiter was published woke the loop instead
+        if (await_ready())
+          kernel::notify(promise);
+      }
+
+      Event await_resume()
+      {
+        release();
+
+        Event pending = std::move(loop_.events_.front());
+        loop_.events_.pop_front();
+        return pending;
+      }
+
+    private:
+      void release()
+      {
+        if (waiting_)
+          loop_.waiter_.store(nullptr);
+
+        waiting_ = false;
+      }
+
+      event_loop& loop_;
+      bool waiting_{false};
+    };
+
+    /**
+     * @brief Awaits the next event from an elib::co_task: `Event e = co_await loop.next_event();`
+     * * From then on the loop is consumed by the coroutine: handlers are no longer
+     * called and events stay queued between two awaits.
+     * @note At most one coroutine may await a loop at a time.
+     */
+    event_awaiter next_event()
+    {
+      awaited_ = true;
+      return event_awaiter{*this};
+    }
+#endif
+
     // --------------------------------------------------------
     // ITask Interface Implementation
     // --------------------------------------------------------
     
     /**
      * @brief Kernel entry point.
-     * Processes up to `maxEventsPerCall()` events from the queue.
+     * Processes up to `maxEventsPerCall()` events from the queue (or hands the queued
+     * blocks to the batch handler) and suspends the loop once the queue is drained
+     * (the next `push()` wakes it up).
      * @note Users should not call this manually; let `elib::kernel::process_all()` drive it.
      */
     void run() override
     {
-      if (events_.empty())
+      // the events belong to the awaiting coroutine (next_event())
+      if (awaited_)
+      {
+        kernel::suspend(*this);
         return;
+      }
+
+      if (batch_handler_)
+        dispatch_batch();
+      else
+        dispatch_events();
+
+      if (events_.empty())
+        kernel::suspend(*this);
+    }
+
+  private:
+    static void empty_handler(const Event&) {}
 
+    void dispatch_events()
+    {
       for (std::size_t count = max_events_per_call_; count > 0 && !events_.empty(); --count)
       {
         Event pending = std::move(events_.front());
@@ -211,11 +367,37 @@ namespace elib
       }
     }
 
-  private:
-    static void empty_handler(const Event&) {}
+    void dispatch_batch()
+    {
+      // the second run starts at the storage begin if the queue wrapped
+      for (int block = 0; block < 2 && !events_.empty(); ++block)
+      {
+        const auto events = events_.array_one();
+        batch_handler_(span<const Event>{events.data(), events.size()});
+        events_.erase_begin(events.size());
+      }
+    }
+
+    // wakes the coroutine waiting in next_event() if any, the loop otherwise
+    void wake()
+    {
+      kernel::task_base* waiter = waiter_.load();
+      kernel::notify(waiter ? *waiter : *this);
+    }
+
+    bool notify_if(bool pushed)
+    {
+      if (pushed)
+        wake();
+
+      return pushed;
+    }
 
     handler_type handler_{empty_handler};
+    batch_handler_type batch_handler_;
     std::size_t max_events_per_call_{1}; 
-    circular_buffer<Event, EventQueueSize> events_;
+    bool awaited_{false};                          // consumed by a coroutine (next_event())
+    std::atomic<kernel::task_base*> waiter_{nullptr}; // coroutine parked in next_event()
+    Queue<Event, EventQueueSize> events_;
   };
 }
\ No newline at end of file
@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file executor.h
+ * @brief Multi-core work-stealing executor for hosted (Linux/Windows) builds.
+ *
+ * Runs the same cooperative, non-blocking tasks as elib::kernel, but on N worker
+ * threads. Every worker keeps a local deque of tasks: it runs the task at the front
+ * for one slice and puts it back at the end (round-robin). An idle worker steals a
+ * task from the end of another worker's deque.
+ *
+ * A task lives in exactly one deque and is taken out of it while it runs, so it never
+ * runs concurrently with itself. A task added with an affinity hint is pinned to that
+ * worker and never stolen (e.g. for thread-confined state).
+ *
+ * @warning Host only (needs <thread>). Add plain kernel::task_base objects, not
+ * elib::task: those are also registered in, and driven by, elib::kernel.
+ *
+ * Usage Example:
+ * @code
+ * elib::host::executor executor{4};
+ *
+ * executor.add(modbus_poller);
+ * executor.add(mqtt_client);
+ * executor.add(display, 0); // always on worker 0
+ *
+ * executor.start();
+ * ...
+ * executor.stop();
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <elib/kernel.h>
+
+namespace elib::host
+{
+  class executor
+  {
+  public:
+    /// Affinity hint: the task may run on (and be stolen by) any worker.
+    static constexpr std::size_t any_worker = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Creates an executor with `worker_num` workers (at least one), not started.
+     */
+    explicit executor(std::size_t worker_num = std::max(1u, std::thread::hardware_concurrency()))
+    {
+      worker_num = std::max<std::size_t>(worker_num, 1);
+      for (std::size_t index = 0; index < worker_num; ++index)
+        workers_.push_back(std::make_unique<worker>());
+    }
+
+    ~executor()
+    {
+      stop();
+    }
+
+    executor(const executor&) = delete;
+    executor& operator=(const executor&) = delete;
+
+    /**
+     * @brief Adds a task to a worker's deque.
+     * @param affinity Worker index to pin the task to, or `any_worker` to let the
+     * executor balance it (out-of-range indices are wrapped).
+     * @note Adding a task twice is not allowed and is ignored.
+     */
+    void add(kernel::task_base& task, std::size_t affinity = any_worker)
+    {
+      std::lock_guard<std::mutex> lock{registry_mutex_};
+      if (find_entry(task))
+        return;
+
+      const bool pinned = affinity != any_worker;
+      const std::size_t index = pinned ? affinity % workers_.size() : next_worker_++ % workers_.size();
+
+      entries_.push_back(std::make_unique<entry>(task, pinned));
+      workers_[index]->push(entries_.back().get());
+    }
+
+    /**
+     * @brief Removes a task, waiting for its current slice to finish.
+     * @note Must not be called from a task's run() for the task itself.
+     */
+    void remove(kernel::task_base& task)
+    {
+      std::lock_guard<std::mutex> lock{registry_mutex_};
+      entry* found = find_entry(task);
+      if (!found)
+        return;
+
+      // a worker re-queues a task under its deque lock only if the flag is still clear,
+      // so after the flag is set every deque is emptied of the task exactly once
+      found->removed.store(true);
+      for (auto& queue : workers_)
+        queue->erase(found);
+
+      while (running(found))
+        std::this_thread::yield();
+
+      entries_.erase(std::find_if(entries_.begin(), entries_.end(),
+                                  [found](const auto& item) { return item.get() == found; }));
+    }
+
+    /**
+     * @brief Starts the worker threads.
+     */
+    void start()
+    {
+      if (running_.exchange(true))
+        return;
+
+      for (std::size_t index = 0; index < workers_.size(); ++index)
+        workers_[index]->thread = std::thread([this, index] { work(index); });
+    }
+
+    /**
+     * @brief Stops the worker threads after their current slice.
+     */
+    void stop()
+    {
+      if (!running_.exchange(false))
+        return;
+
+      for (auto& queue : workers_)
+        queue->thread.join();
+    }
+
+    std::size_t worker_num() const
+    {
+      return workers_.size();
+    }
+
+    /**
+     * @brief Number of tasks stolen by idle workers since construction.
+     */
+    std::size_t steal_count() const
+    {
+      return steals_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct entry
+    {
+      entry(kernel::task_base& task_, bool pinned_)
+        : task{&task_}
+        , pinned{pinned_}
+      {
+      }
+
+      kernel::task_base* task;
+      const bool pinned;
+      std::atomic<bool> removed{false};
+    };
+
+    struct worker
+    {
+      std::mutex mutex;
+      std::deque<entry*> tasks;
+      std::atomic<entry*> current{nullptr};
+      std::thread thread;
+
+      void push(entry* item)
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        tasks.push_back(item);
+      }
+
+      // puts a task back after its slice, unless it was removed meanwhile
+      void requeue(entry* item)
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (!item->removed.load())
+          tasks.push_back(item);
+      }
+
+      // NOTE: `runner.current` is set under the deque lock, so a task is always
+      //       visible to remove() as either queued or running
+
+      entry* pop_front()
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (tasks.empty())
+          return nullptr;
+
+        entry* item = tasks.front();
+        tasks.pop_front();
+        current.store(item);
+        return item;
+      }
+
+      // thieves take from the end, away from the owner, and never take pinned tasks
+      entry* steal(worker& runner)
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        const auto it = std::find_if(tasks.rbegin(), tasks.rend(), [](const entry* item) { return !item->pinned; });
+        if (it == tasks.rend())
+          return nullptr;
+
+        entry* item = *it;
+        tasks.erase(std::next(it).base());
+        runner.current.store(item);
+        return item;
+      }
+
+      void erase(entry* item)
+      {
+        std::lock_guard<std::mutex> lock{mutex};
+        tasks.erase(std::remove(tasks.begin(), tasks.end(), item), tasks.end());
+      }
+    };
+
+    std::vector<std::unique_ptr<worker>> workers_;
+    std::vector<std::unique_ptr<entry>> entries_;
+    std::size_t next_worker_{0};
+
+    std::mutex registry_mutex_; // add()/remove() only, never taken by the workers
+    std::atomic<bool> running_{false};
+    std::atomic<std::size_t> steals_{0};
+
+    entry* find_entry(const kernel::task_base& task) const
+    {
+      const auto it = std::find_if(entries_.begin(), entries_.end(),
+                                   [&task](const auto& item) { return item->task == &task; });
+      return it != entries_.end() ? it->get() : nullptr;
+    }
+
+    bool running(const entry* item) const
+    {
+      return std::any_of(workers_.begin(), workers_.end(),
+                         [item](const auto& queue) { return queue->current.load() == item; });
+    }
+
+    entry* take(std::size_t self)
+    {
+      worker& own = *workers_[self];
+
+      entry* item = own.pop_front();
+      for (std::size_t offset = 1; !item && offset < workers_.size(); ++offset)
+      {
+        item = workers_[(self + offset) % workers_.size()]->steal(own);
+        if (item)
+          steals_.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      return item;
+    }
+
+    void work(std::size_t self)
+    {
+      worker& own = *workers_[self];
+
+      while (running_.load(std::memory_order_relaxed))
+      {
+        entry* item = take(self);
+        if (!item)
+        {
+          // fewer tasks than workers: back off instead of spinning on the locks
+          std::this_thread::sleep_for(std::chrono::microseconds{50});
+          continue;
+        }
+
+        item->task->run();
+
+        own.requeue(item);
+        own.current.store(nullptr);
+      }
+    }
+  };
+}
@@ -0,0 +1,301 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file mirrored_ring.h
+ * @brief Byte ring buffer whose storage is mapped twice, back-to-back, for Linux hosts.
+ *
+ * The same memfd pages back [storage, storage + Capacity) and [storage + Capacity,
+ * storage + 2 * Capacity), so the bytes after the storage end are the bytes at the storage
+ * begin. Every readable or writable region is then a single contiguous span and can be
+ * handed to input_stream/output_stream, parsers or read()/write() system calls as is,
+ * without the two-segment handling circular_buffer needs.
+ *
+ * The API follows circular_buffer (push/pop, bulk copies, write_reserve()/read_acquire());
+ * array_two() is always empty.
+ *
+ * @warning Linux only (memfd_create + mmap). Capacity must be a multiple of the page size;
+ * if the mapping fails the ring is invalid (see valid()) and stays empty and full.
+ *
+ * Usage Example:
+ * @code
+ * elib::host::mirrored_ring<64 * 1024> rx;
+ *
+ * auto free = rx.write_reserve();
+ * rx.write_commit(::read(fd, free.data(), free.size()));
+ *
+ * auto bytes = rx.read_acquire();
+ * elib::data::input_stream in{bytes.data(), bytes.size()};
+ * ...
+ * rx.read_release(in.pos());
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <elib/circular_buffer.h>
+#include <elib/span.h>
+
+namespace elib::host
+{
+  template<std::size_t Capacity>
+  class mirrored_ring
+  {
+    static_assert(Capacity > std::size_t{0} && Capacity % 4096 == 0,
+                  "elib::host::mirrored_ring: Capacity must be a multiple of the page size");
+
+  public:
+    using value_type      = std::uint8_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using size_type       = std::size_t;
+
+    /**
+     * @brief Maps the storage, check valid() for the result.
+     */
+    mirrored_ring()
+      : data_{map()}
+    {
+    }
+
+    ~mirrored_ring()
+    {
+      if (data_)
+        ::munmap(data_, 2 * Capacity);
+    }
+
+    mirrored_ring(const mirrored_ring&) = delete;
+    mirrored_ring& operator=(const mirrored_ring&) = delete;
+
+    mirrored_ring(mirrored_ring&& other) noexcept
+    {
+      *this = std::move(other);
+    }
+
+    mirrored_ring& operator=(mirrored_ring&& other) noexcept
+    {
+      if (this == &other)
+        return *this;
+
+      std::swap(data_, other.data_);
+      std::swap(first_, other.first_);
+      std::swap(size_, other.size_);
+
+      return *this;
+    }
+
+    bool valid() const noexcept
+    {
+      return data_ != nullptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+      return valid();
+    }
+
+    reference front() { return data_[first_]; }
+    const_reference front() const { return data_[first_]; }
+
+    reference back() { return data_[first_ + size_ - 1]; }
+    const_reference back() const { return data_[first_ + size_ - 1]; }
+
+    /**
+     * @brief Access the element at `index` from the front, unchecked. The mirror makes
+     * this a plain offset, no wrap is needed.
+     */
+    reference operator[](size_type index) { return data_[first_ + index]; }
+    const_reference operator[](size_type index) const { return data_[first_ + index]; }
+
+    size_type size() const noexcept { return size_; }
+    constexpr size_type capacity() const noexcept { return Capacity; }
+    bool empty() const noexcept { return !size_; }
+    bool full() const noexcept { return !valid() || size_ == Capacity; }
+
+    bool push_back(value_type value)
+    {
+      if (full())
+        return false;
+
+      data_[first_ + size_] = value;
+      ++size_;
+
+      return true;
+    }
+
+    bool pop_front()
+    {
+      if (empty())
+        return false;
+
+      discard_front(1);
+
+      return true;
+    }
+
+    /**
+     * @brief Appends up to `count` bytes with a single copy.
+     * @return Number of bytes actually pushed.
+     */
+    size_type push_back_n(const value_type* values, size_type count)
+    {
+      const auto reserved = write_reserve();
+      const size_type n = std::min(count, reserved.size());
+      copy(reserved.data(), values, n);
+
+      return write_commit(n);
+    }
+
+    /**
+     * @brief Moves up to `count` bytes from the front into `values` and removes them.
+     * @return Number of bytes actually popped.
+     */
+    size_type pop_front_n(value_type* values, size_type count)
+    {
+      return discard_front(copy_out(0, values, count));
+    }
+
+    /**
+     * @brief Copies up to `count` bytes starting `offset` places after the front, with a single copy.
+     * @return Number of bytes actually copied.
+     */
+    size_type copy_out(size_type offset, value_type* values, size_type count) const
+    {
+      if (offset >= size_)
+        return 0;
+
+      const size_type n = std::min(count, size_ - offset);
+      copy(values, data_ + first_ + offset, n);
+
+      return n;
+    }
+
+    /**
+     * @brief Removes up to `count` bytes from the front.
+     * @return Number of bytes actually removed.
+     */
+    size_type discard_front(size_type count)
+    {
+      count = std::min(count, size_);
+      first_ = detail::wrap<Capacity>(first_ + count);
+      size_ -= count;
+
+      return count;
+    }
+
+    void erase_begin(size_type count)
+    {
+      discard_front(count);
+    }
+
+    /**
+     * @brief Returns all free space after back() as one contiguous run.
+     */
+    span<value_type> write_reserve()
+    {
+      if (!valid())
+        return {};
+
+      return {data_ + first_ + size_, Capacity - size_};
+    }
+
+    /**
+     * @brief Appends the first `count` bytes written into the run returned by write_reserve().
+     * @return Number of bytes actually appended (at most the free space).
+     */
+    size_type write_commit(size_type count)
+    {
+      count = std::min(count, valid() ? Capacity - size_ : 0);
+      size_ += count;
+
+      return count;
+    }
+
+    /**
+     * @brief Returns all bytes as one contiguous run starting at front().
+     */
+    span<value_type> read_acquire() { return {data_ + first_, size_}; }
+    span<const value_type> read_acquire() const { return {data_ + first_, size_}; }
+
+    size_type read_release(size_type count)
+    {
+      return discard_front(count);
+    }
+
+    /// circular_buffer compatibility: all bytes, the wrap is hidden by the mirror.
+    span<value_type> array_one() { return read_acquire(); }
+    span<const value_type> array_one() const { return read_acquire(); }
+
+    /// circular_buffer compatibility: always empty.
+    span<value_type> array_two() { return {data_, 0}; }
+    span<const value_type> array_two() const { return {data_, 0}; }
+
+    void clear()
+    {
+      first_ = 0;
+      size_ = 0;
+    }
+
+  private:
+    pointer data_{nullptr};
+    size_type first_{0};
+    size_type size_{0};
+
+    static void copy(value_type* to, const value_type* from, size_type count)
+    {
+      // memcpy() with a null pointer is undefined even for zero bytes
+      if (count)
+        std::memcpy(to, from, count);
+    }
+
+    // reserves 2 * Capacity of address space, then maps one memfd into both halves
+    static pointer map()
+    {
+      const long page = ::sysconf(_SC_PAGESIZE);
+      if (page <= 0 || Capacity % static_cast<std::size_t>(page) != 0)
+        return nullptr;
+
+      const int fd = ::memfd_create("elib.mirrored_ring", MFD_CLOEXEC);
+      if (fd < 0)
+        return nullptr;
+
+      void* base = MAP_FAILED;
+      if (::ftruncate(fd, static_cast<off_t>(Capacity)) == 0)
+        base = ::mmap(nullptr, 2 * Capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+      if (base != MAP_FAILED)
+      {
+        auto* bytes = static_cast<pointer>(base);
+        const bool mapped =
+          ::mmap(bytes, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+          ::mmap(bytes + Capacity, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+
+        if (!mapped)
+        {
+          ::munmap(base, 2 * Capacity);
+          base = MAP_FAILED;
+        }
+      }
+
+      // the mappings keep the memory alive
+      ::close(fd);
+
+      return base != MAP_FAILED ? static_cast<pointer>(base) : nullptr;
+    }
+  };
+}
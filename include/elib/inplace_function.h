@@ -5,6 +5,8 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 /////////////////////////////////////////////////////////////
 
+#pragma once
+
 #include <elib/external/SG14/inplace_function.h>
 
 namespace elib
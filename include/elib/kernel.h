@@ -17,6 +17,40 @@
  * 2. **Normal Priority**: Tasks are executed sequentially. `process_all()` runs
  * EXACTLY ONE task slice per call to ensure responsiveness.
  *
+ * ## Priority Bands (opt-in)
+ * Setting `elib::kernel::config::priority_levels` above 1 (see elib.tweaks.h) splits
+ * the registry into priority bands. Every band keeps its own round-robin list and a
+ * bitmap of non-empty bands selects the highest one in O(1), so a task registered
+ * with a higher priority runs on the very next slice.
+ * @warning Bands are strict: a higher band that always has a task registered starves
+ * all lower bands. Give high priorities to short-lived or self-stopping tasks.
+ *
+ * ## Ready Set
+ * Only *ready* tasks are dispatched. A registered task is ready until it calls
+ * `kernel::suspend()`; `kernel::notify()` (ISR-safe) makes it ready again.
+ * `event_loop` suspends itself once its queue is drained and `push()` notifies it,
+ * so idle loops cost nothing. `process_all()` returns false when no task was ready,
+ * letting the super loop enter a low-power state:
+ * @code
+ * while (true) {
+ *   if (!elib::kernel::process_all())
+ *     __WFI(); // woken by the next interrupt (e.g. system tick)
+ * }
+ * @endcode
+ *
+ * ## Task Statistics (opt-in)
+ * With `elib::kernel::config::task_stats = true` every slice is timed with
+ * `config::task_stats_counter` (e.g. the DWT cycle counter) and `visit_stats()`
+ * reports run count, total/max execution time and budget overruns per task:
+ * @code
+ * elib::kernel::visit_stats([](const elib::kernel::task_base& task, const elib::kernel::task_stats& stats) {
+ *   log("%p: %u runs, max %u, overruns %u", &task, stats.run_count, stats.max_ticks, stats.overruns);
+ * });
+ * @endcode
+ *
+ * For tickless idle `idle_hint()` tells how long the system may sleep; after wake-up
+ * `elib::time::timer::advance_clock()` moves the clock forward by the slept time.
+ *
  * ## Usage Example
  * @code
  * // 1. Define a custom polling task
@@ -44,10 +78,42 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <elib/function_ref.h>
+#include <elib/time/system_clock.h>
 
 namespace elib::kernel
 {
+  class task_base;
+
+  namespace impl
+  {
+    bool consume_notification(task_base& task);
+    void move_task(task_base& from, task_base& to);
+    std::size_t& registry_slot(task_base& task);
+  }
+
+  /**
+   * @brief Task priority. Higher values are scheduled first.
+   * @note Values above `config::priority_levels - 1` are clamped to the highest band.
+   */
+  using priority_type = std::uint8_t;
+
+  inline constexpr priority_type default_priority = 0;
+
+  /**
+   * @brief Tag: the task is driven by an elib::kernel::static_schedule and is not
+   * added to the runtime registry (see elib::task, elib::event_loop constructors).
+   */
+  struct static_dispatch_t
+  {
+    explicit static_dispatch_t() = default;
+  };
+
+  inline constexpr static_dispatch_t static_dispatch{};
+
   /**
    * @brief Abstract interface for any executable unit in the system.
    * @note Users generally inherit from elib::Task, not ITask directly.
@@ -62,14 +128,24 @@ namespace elib::kernel
      * @warning Must be non-blocking. Any delay here stalls the entire system.
      */
     virtual void run() = 0;
+
+  private:
+    friend void notify(task_base& task);
+    friend bool impl::consume_notification(task_base& task);
+    friend void impl::move_task(task_base& from, task_base& to);
+    friend std::size_t& impl::registry_slot(task_base& task);
+
+    std::atomic<bool> notified_{false};
+    std::size_t slot_{static_cast<std::size_t>(-1)}; // registry slot index, O(1) lookup
   };
 
   /**
    * @brief Registers a task object in the global execution registry.
    * @param task Reference to the task.
+   * @param priority Priority band of the task (ignored if the task is already registered).
    * @return true if registered successfully, false if registry is full.
    */
-  bool register_task(task_base& task);
+  bool register_task(task_base& task, priority_type priority = default_priority);
 
   /**
    * @brief Removes a task from the global execution registry.
@@ -77,6 +153,59 @@ namespace elib::kernel
    */
   void unregister_task(task_base& task);
 
+  /**
+   * @brief Marks a task ready, so the kernel dispatches it again after `suspend()`.
+   * @note Safe to call from ISR. Notifications for unregistered tasks are ignored.
+   */
+  void notify(task_base& task);
+
+  /**
+   * @brief Removes a registered task from the ready set until the next `notify()`.
+   * @note Must be called from task context (typically from the task's own `run()`).
+   * A notification that arrives before or during the call is never lost.
+   */
+  void suspend(task_base& task);
+
+  /**
+   * @brief Result of `idle_hint()`.
+   */
+  struct idle_state
+  {
+    bool work_pending;                        ///< a task is ready, do not sleep
+    time::system_clock::duration sleep_for;   ///< time until the earliest timer deadline
+                                              ///< (zero if due, max() if no timer runs)
+  };
+
+  /**
+   * @brief Tells whether and how long the system may sleep (tickless idle).
+   * @note Sample it with interrupts disabled right before sleeping, so that
+   * a notification raised by an ISR cannot slip in between.
+   */
+  idle_state idle_hint();
+
+  /**
+   * @brief Runtime statistics of one registered task (see config::task_stats).
+   * @note Times are in `config::task_stats_counter` ticks.
+   */
+  struct task_stats
+  {
+    std::uint32_t run_count{0};   ///< number of slices run
+    std::uint64_t total_ticks{0}; ///< execution time of all slices
+    std::uint32_t max_ticks{0};   ///< longest slice
+    std::uint32_t overruns{0};    ///< slices longer than config::task_slice_budget
+  };
+
+  /**
+   * @brief Calls `visitor` with the statistics of every registered task.
+   * @note Does nothing unless config::task_stats is enabled.
+   */
+  void visit_stats(function_ref<void(const task_base&, const task_stats&)> visitor);
+
+  /**
+   * @brief Clears the statistics of all registered tasks.
+   */
+  void reset_stats();
+
   /**
    * @brief Returns the maximum number of concurrent tasks allowed.
    * Defined by elib::kernel::config::maxTaskNum + elib::event::config::maxEventLoopNum.
@@ -84,10 +213,12 @@ namespace elib::kernel
   std::size_t task_max_num();
 
   /**
-   * @brief Manually runs the next task in the round-robin sequence.
+   * @brief Manually runs the next ready task of the highest non-empty priority band
+   * (round-robin inside the band).
+   * @return true if a task was run, false if no task was ready.
    * @note Generally called internally by processAll().
    */
-  void process_tasks();
+  bool process_tasks();
 
   /**
    * @brief The Master System Driver.
@@ -95,9 +226,11 @@ namespace elib::kernel
    * This function should be called continuously in the application's main loop.
    * It performs the following steps:
    * 1. Updates System Timers (elib::time::processTimers).
-   * 2. Runs the next available Task in the registry.
+   * 2. Runs the next ready Task in the registry.
+   *
+   * @return false if no task was ready (the system may sleep until the next interrupt).
    */
-  void process_all();
+  bool process_all();
 
   namespace impl
   {
@@ -107,5 +240,15 @@ namespace elib::kernel
      * @param to The new memory address.
      */
     void move_task(task_base& from, task_base& to);
+
+    /**
+     * @brief Internal helper: clears and returns the pending notification of a task.
+     */
+    bool consume_notification(task_base& task);
+
+    /**
+     * @brief Internal helper: registry slot index stored in the task.
+     */
+    std::size_t& registry_slot(task_base& task);
   }
 }
\ No newline at end of file
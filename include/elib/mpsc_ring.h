@@ -0,0 +1,313 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file mpsc_ring.h
+ * @brief Lock-free multi-producer/single-consumer ring buffer.
+ *
+ * Bounded array queue after D. Vyukov: every slot carries a sequence number that tells
+ * whether it is free for the producer claiming ticket `n` (sequence == n) or holds a
+ * published element for the consumer (sequence == n + 1). Producers claim a ticket with
+ * a single CAS on the tail and never wait for each other or for the consumer.
+ *
+ * @note Requires lock-free compare-and-swap on std::size_t (e.g. LDREX/STREX on ARMv7-M).
+ *       A producer preempted between claiming and publishing a slot only delays the
+ *       consumer, never another producer.
+ *
+ * Usage Example:
+ * @code
+ * // any number of ISRs and tasks post without a critical section
+ * elib::event_loop<sensor_event, 64, elib::mpsc_ring> loop;
+ *
+ * void adc_isr()   { loop.push({sensor::adc, ADC->DR}); }
+ * void timer_isr() { loop.push({sensor::tick, 0}); }
+ * @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <elib/config.h>
+#include <elib/span.h>
+
+namespace elib
+{
+  /**
+   * @brief A fixed-capacity lock-free MPSC queue.
+   *
+   * @tparam Value The type of elements stored in the ring.
+   * @tparam Capacity The maximum number of elements, must be a power of two and at least 2.
+   *
+   * @note Producer API: push_back(), full().
+   *       Consumer API: front(), pop_front(), pop_n(), array_one(), erase_begin(), clear(), empty().
+   *       size() is safe from every side (the result may be stale and includes slots
+   *       claimed but not yet published).
+   *       Copy/move are not thread-safe and require all sides to be idle.
+   */
+  template<typename Value, std::size_t Capacity>
+  class mpsc_ring
+  {
+    static_assert(Capacity >= std::size_t{2} && (Capacity & (Capacity - 1)) == 0,
+                  "elib::mpsc_ring: Capacity must be a power of two and at least 2");
+
+    using storage = std::array<Value, Capacity>;
+
+  public:
+    using reference       = Value&;
+    using const_reference = const Value&;
+    using value_type      = Value;
+    using size_type       = std::size_t;
+
+    mpsc_ring()
+    {
+      reset();
+    }
+
+    mpsc_ring(const mpsc_ring& other)
+    {
+      *this = other;
+    }
+
+    mpsc_ring& operator=(const mpsc_ring& other)
+    {
+      if (this == &other)
+        return *this;
+
+      for (std::size_t index = 0; index < Capacity; ++index)
+        sequences_[index].store(other.sequences_[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+      data_ = other.data_;
+
+      head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+      return *this;
+    }
+
+    mpsc_ring(mpsc_ring&& other) noexcept
+    {
+      *this = std::move(other);
+    }
+
+    mpsc_ring& operator=(mpsc_ring&& other) noexcept
+    {
+      if (this == &other)
+        return *this;
+
+      for (std::size_t index = 0; index < Capacity; ++index)
+        sequences_[index].store(other.sequences_[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+      data_ = std::move(other.data_);
+
+      head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      other.reset();
+
+      return *this;
+    }
+
+    // --------------------------------------------------------
+    // Producer
+    // --------------------------------------------------------
+
+    /**
+     * @brief Adds an element to the end of the ring.
+     * @return true if successful, false if the ring is full.
+     */
+    template<typename T>
+    bool push_back(T&& value)
+    {
+      std::size_t tail = tail_.load(std::memory_order_relaxed);
+
+      for (;;)
+      {
+        std::atomic<std::size_t>& sequence_slot = sequences_[tail & mask];
+        const std::size_t sequence = sequence_slot.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence - tail);
+
+        if (diff == 0)
+        {
+          // slot is free for this ticket, try to claim it (tail is reloaded on failure)
+          if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+          {
+            data_[tail & mask] = std::forward<T>(value);
+            sequence_slot.store(tail + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0)
+        {
+          // the slot still holds the element from the previous lap
+          return false;
+        }
+        else
+        {
+          // another producer claimed this ticket
+          tail = tail_.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    /**
+     * @brief Checks if the ring is full.
+     */
+    bool full() const
+    {
+      return size() >= Capacity;
+    }
+
+    // --------------------------------------------------------
+    // Consumer
+    // --------------------------------------------------------
+
+    /**
+     * @brief Access the first element.
+     * @pre The ring must not be empty.
+     */
+    reference front()
+    {
+      return data_[head_.load(std::memory_order_relaxed) & mask];
+    }
+
+    /**
+     * @brief Access the first element (const).
+     * @pre The ring must not be empty.
+     */
+    const_reference front() const
+    {
+      return data_[head_.load(std::memory_order_relaxed) & mask];
+    }
+
+    /**
+     * @brief Removes the first element.
+     * @return true if successful, false if the ring is empty.
+     */
+    bool pop_front()
+    {
+      const std::size_t head = head_.load(std::memory_order_relaxed);
+      if (!published(head))
+        return false;
+
+      // hand the slot over to the producer of the next lap
+      sequences_[head & mask].store(head + Capacity, std::memory_order_release);
+      head_.store(head + 1, std::memory_order_relaxed);
+
+      return true;
+    }
+
+    /**
+     * @brief Moves up to `count` published elements out of the ring into `values`.
+     * @return Number of elements actually popped.
+     */
+    size_type pop_n(value_type* values, size_type count)
+    {
+      size_type n = 0;
+      for (; n < count && published(head_.load(std::memory_order_relaxed)); ++n)
+      {
+        values[n] = std::move(front());
+        pop_front();
+      }
+
+      return n;
+    }
+
+    /**
+     * @brief Returns the contiguous run of published elements starting at front().
+     * @note The run stops at the first unpublished slot or at the storage end.
+     */
+    span<value_type> array_one()
+    {
+      const size_type head = head_.load(std::memory_order_relaxed);
+
+      size_type n = 0;
+      while (n < Capacity - (head & mask) && published(head + n))
+        ++n;
+
+      return {data_.data() + (head & mask), n};
+    }
+
+    /**
+     * @brief Releases up to `count` published elements from the front back to the producers.
+     */
+    void erase_begin(size_type count)
+    {
+      while (count-- && pop_front())
+      {
+      }
+    }
+
+    /**
+     * @brief Discards all published elements.
+     */
+    void clear()
+    {
+      while (pop_front())
+      {
+      }
+    }
+
+    /**
+     * @brief Checks if the next element is published.
+     * @note Consumer side. A slot claimed but not yet published reads as empty.
+     */
+    bool empty() const
+    {
+      return !published(head_.load(std::memory_order_relaxed));
+    }
+
+    // --------------------------------------------------------
+    // Observers
+    // --------------------------------------------------------
+
+    /**
+     * @brief Returns the number of claimed elements in the ring.
+     */
+    size_type size() const
+    {
+      const size_type head = head_.load(std::memory_order_acquire);
+      return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * @brief Returns the capacity of the ring.
+     */
+    static constexpr size_type capacity()
+    {
+      return Capacity;
+    }
+
+  private:
+    static constexpr size_type mask = Capacity - 1;
+
+    storage data_{};
+    std::array<std::atomic<size_type>, Capacity> sequences_{}; // per slot: free for ticket n (n), published (n + 1)
+
+    // monotonically increasing tickets, the slot index is `ticket & mask`; kept on
+    // separate cache lines on hosts (event::config::ring_counter_alignment)
+    alignas(event::config::ring_counter_alignment) alignas(std::atomic<size_type>)
+    std::atomic<size_type> head_{0}; // written by the consumer only
+    alignas(event::config::ring_counter_alignment) alignas(std::atomic<size_type>)
+    std::atomic<size_type> tail_{0}; // claimed by producers with CAS
+
+    bool published(size_type head) const
+    {
+      return sequences_[head & mask].load(std::memory_order_acquire) == head + 1;
+    }
+
+    void reset()
+    {
+      for (std::size_t index = 0; index < Capacity; ++index)
+        sequences_[index].store(index, std::memory_order_relaxed);
+
+      head_.store(0, std::memory_order_relaxed);
+      tail_.store(0, std::memory_order_relaxed);
+    }
+  };
+}
@@ -0,0 +1,572 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file ring_stream.h
+ * @brief Data streams over the wrapped storage of a circular_buffer, without linearizing it.
+ *
+ * ring_input_stream parses the two contiguous segments of a byte ring (array_one() followed
+ * by array_two()) in place. Fields inside a segment are decoded directly from the ring
+ * storage. A read that straddles the wrap is decoded field by field, down to the scalars
+ * of arrays and messages: only a scalar or a varint that straddles is gathered into a stack
+ * copy of its size (at most 16 bytes), arrays of scalars are copied out in two runs.
+ * The stream is a view: consume the parsed bytes with erase_begin(pos()) afterwards.
+ *
+ * ring_output_stream appends encoded fields to a circular_buffer<std::uint8_t, N>, encoding
+ * them in place into write_reserve() when the free run holds the whole write. Otherwise the
+ * write is encoded field by field in the same way: only a scalar or a varint that straddles
+ * the wrap is staged on the stack, arrays of scalars are appended in two runs.
+ *
+ * Fields use the encodings of output_stream/input_stream: scalars, C arrays and std::array
+ * in host byte order, explicit byte order (read_be/read_le), varints and ELIB_SERIALIZE messages.
+ *
+ * Usage Example:
+ * @code
+ * elib::circular_buffer<std::uint8_t, 256> uart;
+ *
+ * elib::data::ring_input_stream in{uart};
+ * std::uint16_t length{};
+ * if (in.read_be(length) && ...)
+ *   uart.erase_begin(in.pos());
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <elib/circular_buffer.h>
+#include <elib/serialize.h>
+#include <elib/span.h>
+#include <elib/stream.h>
+#include <elib/varint.h>
+
+namespace elib::data
+{
+  /**
+   * @brief Read-only stream over bytes split into two contiguous segments.
+   */
+  class ring_input_stream
+  {
+  public:
+    constexpr ring_input_stream(span<const std::uint8_t> one, span<const std::uint8_t> two) noexcept
+      : one_{one}
+      , two_{two}
+    {
+    }
+
+    template<std::size_t Capacity>
+    explicit ring_input_stream(const circular_buffer<std::uint8_t, Capacity>& buffer) noexcept
+      : ring_input_stream{buffer.array_one(), buffer.array_two()}
+    {
+    }
+
+    constexpr std::size_t pos() const noexcept { return pos_; }
+    constexpr std::size_t size() const noexcept { return one_.size() + two_.size(); }
+    constexpr bool overflow() const noexcept { return overflow_; }
+
+    constexpr bool seek(std::size_t pos) noexcept
+    {
+      // handle empty input
+      if (!pos && !size())
+      {
+        overflow_ = false;
+        return true;
+      }
+
+      if (pos >= size())
+        return false;
+
+      pos_ = pos;
+      overflow_ = false;
+
+      return true;
+    }
+
+    template<typename T, std::enable_if_t<is_serializable_v<T>, int> = 0>
+    T read()
+    {
+      T value{};
+      static_cast<void>(read(value));
+
+      return value;
+    }
+
+    /**
+     * @brief Reads a scalar, an array or an ELIB_SERIALIZE message.
+     */
+    template<typename T, std::enable_if_t<is_serializable_v<T>, int> = 0>
+    bool read(T& value)
+    {
+      return read_all(value);
+    }
+
+    /**
+     * @brief Reads `values.size()` elements, copying at most two runs out of the segments.
+     */
+    template<typename T, std::size_t Extent, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    bool read(span<T, Extent> values)
+    {
+      const std::size_t size = values.size_bytes();
+      if (size > left())
+      {
+        overflow_ = true;
+        return false;
+      }
+
+      copy(reinterpret_cast<std::uint8_t*>(values.data()), size);
+      pos_ += size;
+
+      return true;
+    }
+
+    /**
+     * @brief Reads all fields, with a single bounds check for the whole pack unless it
+     * straddles the wrap.
+     * @return false if the stream holds fewer bytes than the pack (or a message is malformed):
+     * nothing is consumed and overflow is set. A variable-size pack may be partially read then.
+     */
+    template<typename... Fields>
+    bool read_all(Fields&... fields)
+    {
+      constexpr std::size_t max_size = (serialized_max_size_v<Fields> + ... + 0);
+      constexpr bool fixed = (is_fixed_size_v<Fields> && ...);
+      const std::size_t here = contiguous();
+
+      if (here >= max_size || here == left())
+      {
+        // the whole pack is in one segment: decode it in place
+        impl::reader reader{current(), here};
+        if ((impl::read(reader, fields) && ...))
+        {
+          pos_ += here - reader.left;
+          return true;
+        }
+      }
+      else if (!fixed || max_size <= left())
+      {
+        // the pack straddles the wrap: decode field by field, nothing is gathered whole
+        const std::size_t start = pos_;
+        if ((read_field(fields) && ...))
+          return true;
+
+        pos_ = start;
+      }
+
+      overflow_ = true;
+      return false;
+    }
+
+    /**
+     * @brief Reads a scalar stored in big-endian (network) byte order.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    bool read_be(T& value)
+    {
+      return parse<sizeof(T)>([&](const std::uint8_t* at, std::size_t size) {
+        input_stream in{at, size};
+        return in.read_be(value) ? in.pos() : 0;
+      });
+    }
+
+    /**
+     * @brief Reads a scalar stored in little-endian byte order.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    bool read_le(T& value)
+    {
+      return parse<sizeof(T)>([&](const std::uint8_t* at, std::size_t size) {
+        input_stream in{at, size};
+        return in.read_le(value) ? in.pos() : 0;
+      });
+    }
+
+    /**
+     * @brief Reads a LEB128 varint (zig-zag encoded if T is signed), see varint.h.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    bool read_varint(T& value)
+    {
+      return parse<varint_max_size<T>>([&](const std::uint8_t* at, std::size_t size) {
+        return varint_decode(at, size, value);
+      });
+    }
+
+    template<typename T, std::enable_if_t<is_serializable_v<T>, int> = 0>
+    ring_input_stream& operator>>(T& value)
+    {
+      static_cast<void>(read(value));
+
+      return *this;
+    }
+
+    template<typename T, std::size_t Extent>
+    ring_input_stream& operator>>(span<T, Extent> values)
+    {
+      static_cast<void>(read(values));
+
+      return *this;
+    }
+
+  private:
+    span<const std::uint8_t> one_;
+    span<const std::uint8_t> two_;
+    std::size_t pos_{0};
+    bool overflow_{false};
+
+    constexpr std::size_t left() const noexcept { return size() - pos_; }
+
+    // bytes left in the segment holding pos()
+    constexpr std::size_t contiguous() const noexcept
+    {
+      return pos_ < one_.size() ? one_.size() - pos_ : left();
+    }
+
+    const std::uint8_t* current() const noexcept
+    {
+      return pos_ < one_.size() ? one_.data() + pos_ : two_.data() + (pos_ - one_.size());
+    }
+
+    // copies `size` bytes starting at pos() (at most two runs), size <= left()
+    void copy(std::uint8_t* to, std::size_t size) const noexcept
+    {
+      const std::size_t first = std::min(size, contiguous());
+      if (first)
+        std::memcpy(to, current(), first);
+
+      if (size > first)
+        std::memcpy(to + first, two_.data(), size - first);
+    }
+
+    // decodes a field that may straddle the wrap, see read_all()
+    template<typename T>
+    bool read_field(T& value)
+    {
+      if constexpr (is_message_v<T>)
+      {
+        return read_members(value, impl::fields_of<T>{});
+      }
+      else
+      {
+        return parse<sizeof(T)>([&](const std::uint8_t* at, std::size_t size) {
+          return size >= sizeof(T) ? serializer<T>::load(at, value) : 0;
+        });
+      }
+    }
+
+    template<typename T, std::size_t N>
+    bool read_field(T (&values)[N])
+    {
+      return read_range(values, N);
+    }
+
+    template<typename T, std::size_t N>
+    bool read_field(std::array<T, N>& values)
+    {
+      return read_range(values.data(), N);
+    }
+
+    template<typename T, std::size_t Capacity>
+    bool read_field(elib::array<T, Capacity>& values)
+    {
+      std::size_t count{};
+      if (!read_varint(count) || count > Capacity)
+        return false;
+
+      values.clear();
+      for (std::size_t index = 0; index < count; ++index)
+        values.push_back(T{});
+
+      return read_range(values.data(), count);
+    }
+
+    template<typename T, auto... Members>
+    bool read_members(T& message, field_list<Members...>)
+    {
+      return (read_field(message.*Members) && ...);
+    }
+
+    template<typename T>
+    bool read_range(T* values, std::size_t count)
+    {
+      if constexpr (impl::is_scalar_v<T>)
+      {
+        return read(span<T>{values, count});
+      }
+      else
+      {
+        for (std::size_t index = 0; index < count; ++index)
+        {
+          if (!read_field(values[index]))
+            return false;
+        }
+
+        return true;
+      }
+    }
+
+    // runs `decode(bytes, available)` on the bytes at pos(), in place unless a field of up to
+    // MaxSize bytes may straddle the wrap; decode returns the bytes used or 0 on failure
+    template<std::size_t MaxSize, typename Decode>
+    bool parse(Decode&& decode)
+    {
+      if constexpr (MaxSize == 0)
+        return true;
+
+      const std::size_t here = contiguous();
+
+      std::size_t used = 0;
+      if (here >= MaxSize || here == left())
+      {
+        used = decode(current(), here);
+      }
+      else
+      {
+        std::uint8_t scratch[MaxSize];
+        const std::size_t size = std::min(MaxSize, left());
+
+        copy(scratch, size);
+        used = decode(static_cast<const std::uint8_t*>(scratch), size);
+      }
+
+      if (!used)
+      {
+        overflow_ = true;
+        return false;
+      }
+
+      pos_ += used;
+
+      return true;
+    }
+  };
+
+  /**
+   * @brief Stream appending encoded fields to a circular_buffer of bytes.
+   * @note A field is appended whole or not at all.
+   */
+  template<std::size_t Capacity>
+  class ring_output_stream
+  {
+  public:
+    using buffer_type = circular_buffer<std::uint8_t, Capacity>;
+
+    explicit ring_output_stream(buffer_type& buffer) noexcept
+      : buffer_{buffer}
+    {
+    }
+
+    /// Number of bytes appended through this stream.
+    constexpr std::size_t pos() const noexcept { return pos_; }
+    constexpr bool overflow() const noexcept { return overflow_; }
+
+    /**
+     * @brief Appends a scalar, an array or an ELIB_SERIALIZE message.
+     */
+    template<typename T, std::enable_if_t<is_serializable_v<T>, int> = 0>
+    bool write(const T& value)
+    {
+      return write_all(value);
+    }
+
+    template<typename T, std::size_t Extent, typename = std::enable_if_t<std::is_arithmetic_v<std::remove_const_t<T>> || std::is_enum_v<std::remove_const_t<T>>>>
+    bool write(span<T, Extent> values)
+    {
+      const std::size_t size = values.size_bytes();
+      if (set_overflow(size))
+        return false;
+
+      append(reinterpret_cast<const std::uint8_t*>(values.data()), size);
+
+      return true;
+    }
+
+    /**
+     * @brief Appends all fields with a single check of the free space.
+     * @return false (and nothing is written) if the pack does not fit.
+     */
+    template<typename... Fields>
+    bool write_all(const Fields&... fields)
+    {
+      const std::size_t size = (serialized_size(fields) + ... + 0);
+      if (set_overflow(size))
+        return false;
+
+      const auto reserved = buffer_.write_reserve();
+      if (reserved.size() >= size)
+      {
+        // the whole pack fits the free run: encode it in place
+        std::size_t used = 0;
+        ((used += serialize(reserved.data() + used, fields)), ...);
+
+        buffer_.write_commit(size);
+        pos_ += size;
+      }
+      else
+      {
+        // the free space wraps: encode field by field, nothing is staged whole
+        (write_field(fields), ...);
+      }
+
+      return true;
+    }
+
+    /**
+     * @brief Appends a scalar in big-endian (network) byte order.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    bool write_be(T value)
+    {
+      return emit<sizeof(T)>(sizeof(T), [&](std::uint8_t* at) { output_stream{at, sizeof(T)}.write_be(value); });
+    }
+
+    /**
+     * @brief Appends a scalar in little-endian byte order.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    bool write_le(T value)
+    {
+      return emit<sizeof(T)>(sizeof(T), [&](std::uint8_t* at) { output_stream{at, sizeof(T)}.write_le(value); });
+    }
+
+    /**
+     * @brief Appends an integer as a LEB128 varint (zig-zag encoded if signed), see varint.h.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    bool write_varint(T value)
+    {
+      return emit<varint_max_size<T>>(varint_size(value), [&](std::uint8_t* at) { varint_encode(at, value); });
+    }
+
+    template<typename T, std::enable_if_t<is_serializable_v<T>, int> = 0>
+    ring_output_stream& operator<<(const T& value)
+    {
+      static_cast<void>(write(value));
+
+      return *this;
+    }
+
+    template<typename T, std::size_t Extent>
+    ring_output_stream& operator<<(span<T, Extent> values)
+    {
+      static_cast<void>(write(values));
+
+      return *this;
+    }
+
+  private:
+    buffer_type& buffer_;
+    std::size_t pos_{0};
+    bool overflow_{false};
+
+    // the consumer may drain the buffer meanwhile, so unlike output_stream a failed write
+    // does not block the following ones
+    bool set_overflow(std::size_t size) noexcept
+    {
+      if (size <= buffer_.capacity() - buffer_.size())
+        return false;
+
+      overflow_ = true;
+
+      return true;
+    }
+
+    void append(const std::uint8_t* bytes, std::size_t size)
+    {
+      pos_ += buffer_.push_back_n(bytes, size);
+    }
+
+    // encodes a field that may straddle the wrap, see write_all(); the free space is checked
+    template<typename T>
+    void write_field(const T& value)
+    {
+      if constexpr (is_message_v<T>)
+      {
+        write_members(value, impl::fields_of<T>{});
+      }
+      else
+      {
+        emit<sizeof(T)>(sizeof(T), [&](std::uint8_t* at) { serializer<T>::store(at, value); });
+      }
+    }
+
+    template<typename T, std::size_t N>
+    void write_field(const T (&values)[N])
+    {
+      write_range(values, N);
+    }
+
+    template<typename T, std::size_t N>
+    void write_field(const std::array<T, N>& values)
+    {
+      write_range(values.data(), N);
+    }
+
+    template<typename T, std::size_t MaxCount>
+    void write_field(const elib::array<T, MaxCount>& values)
+    {
+      write_varint(values.size());
+      write_range(values.data(), values.size());
+    }
+
+    template<typename T, auto... Members>
+    void write_members(const T& message, field_list<Members...>)
+    {
+      (write_field(message.*Members), ...);
+    }
+
+    template<typename T>
+    void write_range(const T* values, std::size_t count)
+    {
+      if constexpr (impl::is_scalar_v<T>)
+      {
+        append(reinterpret_cast<const std::uint8_t*>(values), count * sizeof(T));
+      }
+      else
+      {
+        for (std::size_t index = 0; index < count; ++index)
+          write_field(values[index]);
+      }
+    }
+
+    // runs `encode(bytes)` writing `size` (<= MaxSize) bytes and appends them: in place in the
+    // ring storage when the free space after back() is contiguous, through a stack copy otherwise
+    template<std::size_t MaxSize, typename Encode>
+    bool emit(std::size_t size, Encode&& encode)
+    {
+      if (set_overflow(size))
+        return false;
+
+      if constexpr (MaxSize > 0)
+      {
+        const auto reserved = buffer_.write_reserve();
+        if (reserved.size() >= size)
+        {
+          encode(reserved.data());
+          buffer_.write_commit(size);
+        }
+        else
+        {
+          std::uint8_t scratch[MaxSize];
+          encode(scratch);
+          buffer_.push_back_n(scratch, size);
+        }
+
+        pos_ += size;
+      }
+
+      return true;
+    }
+  };
+
+  template<std::size_t Capacity>
+  ring_output_stream(circular_buffer<std::uint8_t, Capacity>&) -> ring_output_stream<Capacity>;
+}
@@ -0,0 +1,473 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file serialize.h
+ * @brief Compile-time field lists for message structs and their binary encoding.
+ *
+ * ELIB_SERIALIZE(type, fields...) lists the members to serialize, in order. The encoder,
+ * the decoder and the encoded size are generated from that single list, so they cannot
+ * drift apart. Supported fields: arithmetic and enum scalars (host byte order, as
+ * output_stream::write), C arrays, std::array, elib::array (varint element count followed
+ * by the elements) and nested structs described with ELIB_SERIALIZE.
+ *
+ * Messages without elib::array fields have a fixed size known at compile time
+ * (serialized_max_size_v), encoding and decoding them takes a single bounds check.
+ *
+ * The macro goes to the namespace of the struct (the generated function is found by ADL),
+ * the listed members must be accessible there. At most 32 fields per struct.
+ *
+ * Usage Example:
+ * @code
+ * namespace app
+ * {
+ *   struct point { std::int16_t x; std::int16_t y; };
+ *   ELIB_SERIALIZE(point, x, y)
+ *
+ *   struct track { std::uint32_t id; std::array<point, 4> corners; elib::array<point, 16> path; };
+ *   ELIB_SERIALIZE(track, id, corners, path)
+ * }
+ *
+ * static_assert(elib::data::serialized_max_size_v<app::point> == 4);
+ *
+ * app::track track{};
+ * std::uint8_t payload[elib::data::serialized_max_size_v<app::track>];
+ * elib::data::output_stream out{payload};
+ * out << track;
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <array>
+
+#include <elib/array.h>
+#include <elib/varint.h>
+
+#define ELIB_SERIALIZE_EXPAND(x) x
+#define ELIB_SERIALIZE_COUNT(...) ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_COUNT_N(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define ELIB_SERIALIZE_COUNT_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+
+#define ELIB_SERIALIZE_M1(Type, field) &Type::field
+#define ELIB_SERIALIZE_M2(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M1(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M3(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M2(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M4(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M3(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M5(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M4(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M6(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M5(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M7(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M6(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M8(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M7(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M9(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M8(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M10(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M9(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M11(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M10(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M12(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M11(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M13(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M12(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M14(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M13(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M15(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M14(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M16(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M15(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M17(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M16(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M18(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M17(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M19(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M18(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M20(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M19(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M21(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M20(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M22(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M21(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M23(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M22(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M24(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M23(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M25(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M24(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M26(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M25(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M27(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M26(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M28(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M27(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M29(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M28(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M30(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M29(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M31(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M30(Type, __VA_ARGS__))
+#define ELIB_SERIALIZE_M32(Type, field, ...) &Type::field, ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_M31(Type, __VA_ARGS__))
+
+#define ELIB_SERIALIZE_CONCAT_(a, b) a##b
+#define ELIB_SERIALIZE_CONCAT(a, b) ELIB_SERIALIZE_CONCAT_(a, b)
+#define ELIB_SERIALIZE_MEMBERS(Type, ...) \
+  ELIB_SERIALIZE_EXPAND(ELIB_SERIALIZE_CONCAT(ELIB_SERIALIZE_M, ELIB_SERIALIZE_COUNT(__VA_ARGS__))(Type, __VA_ARGS__))
+
+/**
+ * @brief Lists the members of `Type` to serialize, in encoding order.
+ */
+#define ELIB_SERIALIZE(Type, ...)                                                             \
+  [[maybe_unused]] constexpr ::elib::data::field_list<ELIB_SERIALIZE_MEMBERS(Type, __VA_ARGS__)> \
+  elib_serialize_fields(const Type*) noexcept                                                 \
+  {                                                                                           \
+    return {};                                                                                \
+  }
+
+namespace elib::data
+{
+  /// Members listed by ELIB_SERIALIZE, as pointers to members.
+  template<auto... Members>
+  struct field_list
+  {
+  };
+
+  /**
+   * @brief Encoding rules of T. Specializations provide:
+   * - `fixed`: the encoded size does not depend on the value,
+   * - `max_size`: the largest encoded size,
+   * - `store()`: unchecked encoding, returns the number of bytes written,
+   * - `load()` for fixed types: unchecked decoding of `max_size` bytes,
+   * - `size()` and `read()` for variable types: the encoded size of a value and checked decoding.
+   */
+  template<typename T, typename = void>
+  struct serializer
+  {
+    static constexpr bool supported = false;
+  };
+
+  template<typename T>
+  inline constexpr bool is_serializable_v = serializer<T>::supported;
+
+  template<typename T>
+  inline constexpr bool is_fixed_size_v = serializer<T>::fixed;
+
+  /// Largest encoded size of T, the exact size if is_fixed_size_v<T>.
+  template<typename T>
+  inline constexpr std::size_t serialized_max_size_v = serializer<T>::max_size;
+
+  namespace impl
+  {
+    // bounds-checked cursor over the bytes being decoded
+    struct reader
+    {
+      const std::uint8_t* at;
+      std::size_t left;
+
+      // start of the next `size` bytes, nullptr if fewer are left
+      const std::uint8_t* take(std::size_t size) noexcept
+      {
+        if (size > left)
+          return nullptr;
+
+        const std::uint8_t* bytes = at;
+        at += size;
+        left -= size;
+
+        return bytes;
+      }
+    };
+
+    template<typename T, typename = void>
+    struct is_message : std::false_type
+    {
+    };
+
+    template<typename T>
+    struct is_message<T, std::void_t<decltype(elib_serialize_fields(static_cast<const T*>(nullptr)))>> : std::true_type
+    {
+    };
+
+    template<typename T>
+    using fields_of = decltype(elib_serialize_fields(static_cast<const T*>(nullptr)));
+
+    template<typename Member>
+    struct member_type;
+
+    template<typename Class, typename Value>
+    struct member_type<Value Class::*>
+    {
+      using type = std::remove_cv_t<Value>;
+    };
+
+    template<auto Member>
+    using member_t = typename member_type<decltype(Member)>::type;
+
+    template<typename T>
+    inline constexpr bool is_scalar_v = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+    template<typename T>
+    constexpr std::size_t size_of(const T& value) noexcept
+    {
+      if constexpr (serializer<T>::fixed)
+        return serializer<T>::max_size;
+      else
+        return serializer<T>::size(value);
+    }
+
+    template<typename T>
+    bool read(reader& in, T& value) noexcept
+    {
+      if constexpr (serializer<T>::fixed)
+      {
+        // a single check for the whole fixed-size value
+        const std::uint8_t* bytes = in.take(serializer<T>::max_size);
+        if (!bytes)
+          return false;
+
+        serializer<T>::load(bytes, value);
+
+        return true;
+      }
+      else
+      {
+        return serializer<T>::read(in, value);
+      }
+    }
+
+    // element ranges of arrays, a single copy for scalars
+
+    template<typename T>
+    constexpr std::size_t size_of_range(const T* values, std::size_t count) noexcept
+    {
+      if constexpr (serializer<T>::fixed)
+      {
+        return count * serializer<T>::max_size;
+      }
+      else
+      {
+        std::size_t size = 0;
+        for (std::size_t index = 0; index < count; ++index)
+          size += serializer<T>::size(values[index]);
+
+        return size;
+      }
+    }
+
+    template<typename T>
+    std::size_t store_range(std::uint8_t* at, const T* values, std::size_t count) noexcept
+    {
+      if constexpr (is_scalar_v<T>)
+      {
+        if (count)
+          std::memcpy(at, values, count * sizeof(T));
+
+        return count * sizeof(T);
+      }
+      else
+      {
+        std::size_t pos = 0;
+        for (std::size_t index = 0; index < count; ++index)
+          pos += serializer<T>::store(at + pos, values[index]);
+
+        return pos;
+      }
+    }
+
+    template<typename T>
+    std::size_t load_range(const std::uint8_t* at, T* values, std::size_t count) noexcept
+    {
+      if constexpr (is_scalar_v<T>)
+      {
+        if (count)
+          std::memcpy(values, at, count * sizeof(T));
+
+        return count * sizeof(T);
+      }
+      else
+      {
+        std::size_t pos = 0;
+        for (std::size_t index = 0; index < count; ++index)
+          pos += serializer<T>::load(at + pos, values[index]);
+
+        return pos;
+      }
+    }
+
+    template<typename T>
+    bool read_range(reader& in, T* values, std::size_t count) noexcept
+    {
+      if constexpr (serializer<T>::fixed)
+      {
+        const std::uint8_t* bytes = in.take(count * serializer<T>::max_size);
+        if (!bytes)
+          return false;
+
+        load_range(bytes, values, count);
+
+        return true;
+      }
+      else
+      {
+        for (std::size_t index = 0; index < count; ++index)
+        {
+          if (!serializer<T>::read(in, values[index]))
+            return false;
+        }
+
+        return true;
+      }
+    }
+
+    template<typename T, std::size_t N>
+    struct sequence_serializer
+    {
+      static constexpr bool supported = true;
+      static constexpr bool fixed = serializer<T>::fixed;
+      static constexpr std::size_t max_size = N * serializer<T>::max_size;
+
+      static constexpr std::size_t size(const T* values) noexcept { return size_of_range(values, N); }
+      static std::size_t store(std::uint8_t* at, const T* values) noexcept { return store_range(at, values, N); }
+      static std::size_t load(const std::uint8_t* at, T* values) noexcept { return load_range(at, values, N); }
+      static bool read(reader& in, T* values) noexcept { return read_range(in, values, N); }
+    };
+
+    template<typename T, typename Fields>
+    struct message_serializer;
+
+    template<typename T, auto... Members>
+    struct message_serializer<T, field_list<Members...>>
+    {
+      static_assert((is_serializable_v<member_t<Members>> && ...),
+                    "elib::data: ELIB_SERIALIZE lists a field of an unsupported type");
+
+      static constexpr bool supported = true;
+      static constexpr bool fixed = (serializer<member_t<Members>>::fixed && ...);
+      static constexpr std::size_t max_size = (serializer<member_t<Members>>::max_size + ... + 0);
+
+      static constexpr std::size_t size(const T& message) noexcept
+      {
+        return (size_of(message.*Members) + ... + 0);
+      }
+
+      static std::size_t store(std::uint8_t* at, const T& message) noexcept
+      {
+        std::size_t pos = 0;
+        ((pos += serializer<member_t<Members>>::store(at + pos, message.*Members)), ...);
+
+        return pos;
+      }
+
+      static std::size_t load(const std::uint8_t* at, T& message) noexcept
+      {
+        std::size_t pos = 0;
+        ((pos += serializer<member_t<Members>>::load(at + pos, message.*Members)), ...);
+
+        return pos;
+      }
+
+      static bool read(reader& in, T& message) noexcept
+      {
+        return (impl::read(in, message.*Members) && ...);
+      }
+    };
+  }
+
+  template<typename T>
+  inline constexpr bool is_message_v = impl::is_message<T>::value;
+
+  template<typename T>
+  struct serializer<T, std::enable_if_t<impl::is_scalar_v<T>>>
+  {
+    static constexpr bool supported = true;
+    static constexpr bool fixed = true;
+    static constexpr std::size_t max_size = sizeof(T);
+
+    static std::size_t store(std::uint8_t* at, T value) noexcept
+    {
+      std::memcpy(at, &value, sizeof(T));
+      return sizeof(T);
+    }
+
+    static std::size_t load(const std::uint8_t* at, T& value) noexcept
+    {
+      std::memcpy(&value, at, sizeof(T));
+      return sizeof(T);
+    }
+  };
+
+  template<typename T, std::size_t N>
+  struct serializer<T[N], std::enable_if_t<is_serializable_v<T>>> : impl::sequence_serializer<T, N>
+  {
+  };
+
+  template<typename T, std::size_t N>
+  struct serializer<std::array<T, N>, std::enable_if_t<is_serializable_v<T>>>
+  {
+    using sequence = impl::sequence_serializer<T, N>;
+
+    static constexpr bool supported = true;
+    static constexpr bool fixed = sequence::fixed;
+    static constexpr std::size_t max_size = sequence::max_size;
+
+    static constexpr std::size_t size(const std::array<T, N>& values) noexcept { return sequence::size(values.data()); }
+    static std::size_t store(std::uint8_t* at, const std::array<T, N>& values) noexcept { return sequence::store(at, values.data()); }
+    static std::size_t load(const std::uint8_t* at, std::array<T, N>& values) noexcept { return sequence::load(at, values.data()); }
+    static bool read(impl::reader& in, std::array<T, N>& values) noexcept { return sequence::read(in, values.data()); }
+  };
+
+  // element count as a varint, then the elements
+  template<typename T, std::size_t Capacity>
+  struct serializer<elib::array<T, Capacity>, std::enable_if_t<is_serializable_v<T>>>
+  {
+    static constexpr bool supported = true;
+    static constexpr bool fixed = false;
+    static constexpr std::size_t max_size = varint_size(Capacity) + Capacity * serializer<T>::max_size;
+
+    static constexpr std::size_t size(const elib::array<T, Capacity>& values) noexcept
+    {
+      return varint_size(values.size()) + impl::size_of_range(values.data(), values.size());
+    }
+
+    static std::size_t store(std::uint8_t* at, const elib::array<T, Capacity>& values) noexcept
+    {
+      const std::size_t pos = varint_encode(at, values.size());
+      return pos + impl::store_range(at + pos, values.data(), values.size());
+    }
+
+    static bool read(impl::reader& in, elib::array<T, Capacity>& values) noexcept
+    {
+      std::size_t count{};
+      const std::size_t used = varint_decode(in.at, in.left, count);
+      if (!used || count > Capacity)
+        return false;
+
+      in.take(used);
+
+      values.clear();
+      for (std::size_t index = 0; index < count; ++index)
+        values.push_back(T{});
+
+      return impl::read_range(in, values.data(), count);
+    }
+  };
+
+  template<typename T>
+  struct serializer<T, std::enable_if_t<impl::is_message<T>::value>> : impl::message_serializer<T, impl::fields_of<T>>
+  {
+  };
+
+  /**
+   * @brief Number of bytes serialize() writes for `value`.
+   */
+  template<typename T, typename = std::enable_if_t<is_serializable_v<T>>>
+  constexpr std::size_t serialized_size(const T& value) noexcept
+  {
+    return impl::size_of(value);
+  }
+
+  /**
+   * @brief Encodes `value` to `out`, which must hold serialized_size(value) bytes.
+   * @return Number of bytes written.
+   */
+  template<typename T, typename = std::enable_if_t<is_serializable_v<T>>>
+  std::size_t serialize(std::uint8_t* out, const T& value) noexcept
+  {
+    return serializer<T>::store(out, value);
+  }
+
+  /**
+   * @brief Decodes `value` from the `size` bytes at `in`.
+   * @return Number of bytes consumed, 0 if the input is truncated or malformed
+   * (`value` may be partially updated then).
+   */
+  template<typename T, typename = std::enable_if_t<is_serializable_v<T>>>
+  std::size_t deserialize(const std::uint8_t* in, std::size_t size, T& value) noexcept
+  {
+    impl::reader reader{in, size};
+    if (!impl::read(reader, value))
+      return 0;
+
+    return size - reader.left;
+  }
+}
@@ -0,0 +1,284 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file spsc_ring.h
+ * @brief Lock-free single-producer/single-consumer ring buffer.
+ *
+ * One context (e.g. an ISR or a producer thread) pushes, one context (e.g. the task
+ * that owns an event_loop) pops. Head and tail are monotonically increasing atomic
+ * counters published with acquire/release ordering, there is no shared size counter,
+ * so neither side ever writes a variable the other side writes.
+ *
+ * Usage Example:
+ * @code
+ * elib::spsc_ring<std::uint8_t, 256> rx;
+ *
+ * void uart_isr() { rx.push_back(UART->DR); }        // producer
+ *
+ * void parser_task() {                               // consumer
+ *   std::uint8_t chunk[32];
+ *   const std::size_t n = rx.pop_n(chunk, sizeof(chunk));
+ *   parse(chunk, n);
+ * }
+ *
+ * // or as the queue of an event loop
+ * elib::event_loop<sensor_event, 64, elib::spsc_ring> loop;
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <elib/config.h>
+#include <elib/span.h>
+
+namespace elib
+{
+  /**
+   * @brief A fixed-capacity lock-free SPSC queue.
+   *
+   * @tparam Value The type of elements stored in the ring.
+   * @tparam Capacity The maximum number of elements, must be a power of two.
+   *
+   * @note Producer API: push_back(), push_n(), full().
+   *       Consumer API: front(), pop_front(), pop_n(), array_one(), erase_begin(), clear().
+   *       size()/empty() are safe from both sides (the result may be stale).
+   *       Copy/move are not thread-safe and require both sides to be idle.
+   */
+  template<typename Value, std::size_t Capacity>
+  class spsc_ring
+  {
+    static_assert(Capacity > std::size_t{0} && (Capacity & (Capacity - 1)) == 0,
+                  "elib::spsc_ring: Capacity must be a power of two");
+
+    using storage = std::array<Value, Capacity>;
+
+  public:
+    using reference       = typename storage::reference;
+    using const_reference = typename storage::const_reference;
+    using value_type      = typename storage::value_type;
+    using size_type       = typename storage::size_type;
+
+    constexpr spsc_ring() = default;
+
+    spsc_ring(const spsc_ring& other)
+    {
+      *this = other;
+    }
+
+    spsc_ring& operator=(const spsc_ring& other)
+    {
+      if (this == &other)
+        return *this;
+
+      data_ = other.data_;
+      head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+      return *this;
+    }
+
+    spsc_ring(spsc_ring&& other) noexcept
+    {
+      *this = std::move(other);
+    }
+
+    spsc_ring& operator=(spsc_ring&& other) noexcept
+    {
+      if (this == &other)
+        return *this;
+
+      data_ = std::move(other.data_);
+      head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      other.clear();
+
+      return *this;
+    }
+
+    // --------------------------------------------------------
+    // Producer
+    // --------------------------------------------------------
+
+    /**
+     * @brief Adds an element to the end of the ring.
+     * @return true if successful, false if the ring is full.
+     */
+    template<typename T>
+    bool push_back(T&& value)
+    {
+      const size_type tail = tail_.load(std::memory_order_relaxed);
+      if (tail - head_.load(std::memory_order_acquire) == Capacity)
+        return false;
+
+      data_[tail & mask] = std::forward<T>(value);
+      tail_.store(tail + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    /**
+     * @brief Adds up to `count` elements, publishing them with a single release store.
+     * @return Number of elements actually pushed.
+     */
+    size_type push_n(const value_type* values, size_type count)
+    {
+      const size_type tail = tail_.load(std::memory_order_relaxed);
+      const size_type free = Capacity - (tail - head_.load(std::memory_order_acquire));
+      const size_type n = std::min(count, free);
+
+      // at most two contiguous segments: [tail, storage end) and [storage begin, ...)
+      const size_type first = std::min(n, Capacity - (tail & mask));
+      std::copy(values, values + first, data_.data() + (tail & mask));
+      std::copy(values + first, values + n, data_.data());
+
+      tail_.store(tail + n, std::memory_order_release);
+
+      return n;
+    }
+
+    /**
+     * @brief Checks if the ring is full.
+     */
+    bool full() const
+    {
+      return size() == Capacity;
+    }
+
+    // --------------------------------------------------------
+    // Consumer
+    // --------------------------------------------------------
+
+    /**
+     * @brief Access the first element.
+     * @pre The ring must not be empty.
+     */
+    reference front()
+    {
+      return data_[head_.load(std::memory_order_relaxed) & mask];
+    }
+
+    /**
+     * @brief Access the first element (const).
+     * @pre The ring must not be empty.
+     */
+    const_reference front() const
+    {
+      return data_[head_.load(std::memory_order_relaxed) & mask];
+    }
+
+    /**
+     * @brief Removes the first element.
+     * @return true if successful, false if the ring is empty.
+     */
+    bool pop_front()
+    {
+      const size_type head = head_.load(std::memory_order_relaxed);
+      if (head == tail_.load(std::memory_order_acquire))
+        return false;
+
+      head_.store(head + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    /**
+     * @brief Moves up to `count` elements out of the ring into `values`.
+     * @return Number of elements actually popped.
+     */
+    size_type pop_n(value_type* values, size_type count)
+    {
+      const size_type head = head_.load(std::memory_order_relaxed);
+      const size_type n = std::min(count, tail_.load(std::memory_order_acquire) - head);
+
+      const size_type first = std::min(n, Capacity - (head & mask));
+      std::move(data_.data() + (head & mask), data_.data() + (head & mask) + first, values);
+      std::move(data_.data(), data_.data() + (n - first), values + first);
+
+      head_.store(head + n, std::memory_order_release);
+
+      return n;
+    }
+
+    /**
+     * @brief Returns the contiguous run of published elements starting at front().
+     * @note The run ends at the storage end, the rest (if any) starts at the storage begin.
+     */
+    span<value_type> array_one()
+    {
+      const size_type head = head_.load(std::memory_order_relaxed);
+      const size_type n = tail_.load(std::memory_order_acquire) - head;
+
+      return {data_.data() + (head & mask), std::min(n, Capacity - (head & mask))};
+    }
+
+    /**
+     * @brief Releases up to `count` elements from the front back to the producer.
+     */
+    void erase_begin(size_type count)
+    {
+      const size_type head = head_.load(std::memory_order_relaxed);
+      const size_type n = std::min(count, tail_.load(std::memory_order_acquire) - head);
+
+      head_.store(head + n, std::memory_order_release);
+    }
+
+    /**
+     * @brief Discards all elements currently visible to the consumer.
+     */
+    void clear()
+    {
+      head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // --------------------------------------------------------
+    // Observers
+    // --------------------------------------------------------
+
+    /**
+     * @brief Returns the number of elements in the ring.
+     */
+    size_type size() const
+    {
+      const size_type head = head_.load(std::memory_order_acquire);
+      return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * @brief Checks if the ring is empty.
+     */
+    bool empty() const
+    {
+      return !size();
+    }
+
+    /**
+     * @brief Returns the capacity of the ring.
+     */
+    static constexpr size_type capacity()
+    {
+      return Capacity;
+    }
+
+  private:
+    static constexpr size_type mask = Capacity - 1;
+
+    storage data_{};
+
+    // monotonically increasing counters, the slot index is `counter & mask`; kept on
+    // separate cache lines on hosts (event::config::ring_counter_alignment)
+    alignas(event::config::ring_counter_alignment) alignas(std::atomic<size_type>)
+    std::atomic<size_type> head_{0}; // written by the consumer only
+    alignas(event::config::ring_counter_alignment) alignas(std::atomic<size_type>)
+    std::atomic<size_type> tail_{0}; // written by the producer only
+  };
+}
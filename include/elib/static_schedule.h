@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file static_schedule.h
+ * @brief Compile-time task table for tasks known at build time.
+ *
+ * The task set is a list of global objects given as template arguments. Dispatch is
+ * a fully inlined sequence of qualified (non-virtual) `run()` calls: no registration,
+ * no registry slot and no dependency on static initialization order. Dynamic tasks
+ * registered with elib::kernel keep running next to the static ones.
+ *
+ * A scheduled object only needs a `void run()` member. elib::task and elib::event_loop
+ * objects must be constructed with `elib::kernel::static_dispatch`, otherwise they are
+ * registered in the kernel as well and would run twice.
+ *
+ * Usage Example:
+ * @code
+ * sensor_task sensors;                                            // any class with run()
+ * elib::event_loop<command, 8> commands{elib::kernel::static_dispatch};
+ *
+ * using schedule = elib::kernel::static_schedule<sensors, commands>;
+ *
+ * int main() {
+ *   while (true)
+ *     schedule::process_all(); // timers, one static task, one dynamic task
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <elib/kernel.h>
+#include <elib/time/timer.h>
+
+namespace elib::kernel
+{
+  /**
+   * @brief Static round-robin schedule over a fixed set of task objects.
+   * @tparam Tasks Objects with static storage duration providing `void run()`.
+   */
+  template<auto&... Tasks>
+  class static_schedule
+  {
+    static_assert(sizeof...(Tasks) > 0, "elib::kernel::static_schedule: the task list is empty");
+
+  public:
+    static_schedule() = delete;
+
+    /**
+     * @brief Number of tasks in the schedule.
+     */
+    static constexpr std::size_t size()
+    {
+      return sizeof...(Tasks);
+    }
+
+    /**
+     * @brief Runs every static task once, in declaration order.
+     */
+    static void run_all()
+    {
+      (run_task<Tasks>(), ...);
+    }
+
+    /**
+     * @brief Runs the next static task (round-robin), one slice per call.
+     */
+    static void process_tasks()
+    {
+      std::size_t index = 0;
+      ((index++ == cursor_ ? (run_task<Tasks>(), true) : false) || ...);
+
+      if (++cursor_ == sizeof...(Tasks))
+        cursor_ = 0;
+    }
+
+    /**
+     * @brief Super-loop driver: processes timers, then one static task and one
+     * ready dynamic task (elib::kernel::process_tasks).
+     * @return Result of the dynamic dispatch: false if no dynamic task was ready.
+     */
+    static bool process_all()
+    {
+      elib::time::timer::process_timers();
+      process_tasks();
+
+      return kernel::process_tasks();
+    }
+
+  private:
+    static inline std::size_t cursor_{0};
+
+    template<auto& Task>
+    static void run_task()
+    {
+      using task_type = std::remove_cv_t<std::remove_reference_t<decltype(Task)>>;
+
+      // qualified call: bound at compile time even if run() is virtual
+      Task.task_type::run();
+    }
+  };
+}
@@ -11,6 +11,11 @@
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
+#include <elib/assert.h>
+#include <elib/bit.h>
+#include <elib/serialize.h>
+#include <elib/span.h>
+#include <elib/varint.h>
 
 namespace elib::data
 {
@@ -60,10 +65,112 @@ namespace elib::data
     template<typename T>
     using enable_if_trivial = std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, T>;
 
+    template<typename T, typename = enable_if_trivial<T>>
+    static constexpr std::size_t size_bytes(T) noexcept { return sizeof(T); }
     template<typename T, std::size_t N>
     static constexpr std::size_t size_bytes(const std::array<T, N>&) noexcept { return N * sizeof(T); }
     template<typename T, std::size_t N>
     static constexpr std::size_t size_bytes(const T(&)[N]) noexcept { return N * sizeof(T); }
+    template<typename T, std::size_t Extent>
+    static constexpr std::size_t size_bytes(span<T, Extent> values) noexcept { return values.size_bytes(); }
+
+    // unchecked copies of a field to/from `at`, return the number of bytes copied
+
+    template<typename T, typename = enable_if_trivial<T>>
+    static std::size_t store(std::uint8_t* at, T value) noexcept
+    {
+      if constexpr (sizeof(T) == sizeof(std::uint8_t))
+        *at = static_cast<std::uint8_t>(value);
+      else
+        std::memcpy(at, &value, sizeof(T));
+
+      return sizeof(T);
+    }
+    template<typename T, std::size_t N>
+    static std::size_t store(std::uint8_t* at, const std::array<T, N>& array) noexcept { return store_bytes(at, array.data(), size_bytes(array)); }
+    template<typename T, std::size_t N>
+    static std::size_t store(std::uint8_t* at, const T(&array)[N]) noexcept { return store_bytes(at, array, size_bytes(array)); }
+    template<typename T, std::size_t Extent>
+    static std::size_t store(std::uint8_t* at, span<T, Extent> values) noexcept { return store_bytes(at, values.data(), values.size_bytes()); }
+
+    template<typename T, typename = enable_if_trivial<T>>
+    static std::size_t load(const std::uint8_t* at, T& value) noexcept
+    {
+      if constexpr (sizeof(T) == sizeof(std::uint8_t))
+        value = static_cast<T>(*at);
+      else
+        std::memcpy(&value, at, sizeof(T));
+
+      return sizeof(T);
+    }
+    template<typename T, std::size_t N>
+    static std::size_t load(const std::uint8_t* at, std::array<T, N>& array) noexcept { return load_bytes(array.data(), at, size_bytes(array)); }
+    template<typename T, std::size_t N>
+    static std::size_t load(const std::uint8_t* at, T(&array)[N]) noexcept { return load_bytes(array, at, size_bytes(array)); }
+    template<typename T, std::size_t Extent>
+    static std::size_t load(const std::uint8_t* at, span<T, Extent> values) noexcept { return load_bytes(values.data(), at, values.size_bytes()); }
+
+    template<std::size_t Size>
+    using uint_of = std::conditional_t<Size == 1, std::uint8_t,
+                    std::conditional_t<Size == 2, std::uint16_t,
+                    std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>>;
+
+    // scalar copies in a fixed byte order, a plain copy or a copy of the byte-swapped value
+
+    template<endian Order, typename T, typename = enable_if_trivial<T>>
+    static std::size_t store_ordered(std::uint8_t* at, T value) noexcept
+    {
+      static_assert(sizeof(T) <= sizeof(std::uint64_t), "elib::data: unsupported scalar size");
+
+      if constexpr (Order == endian::native || sizeof(T) == 1)
+      {
+        return store(at, value);
+      }
+      else
+      {
+        uint_of<sizeof(T)> bits;
+        std::memcpy(&bits, &value, sizeof(T));
+
+        return store(at, byteswap(bits));
+      }
+    }
+
+    template<endian Order, typename T, typename = enable_if_trivial<T>>
+    static std::size_t load_ordered(const std::uint8_t* at, T& value) noexcept
+    {
+      static_assert(sizeof(T) <= sizeof(std::uint64_t), "elib::data: unsupported scalar size");
+
+      if constexpr (Order == endian::native || sizeof(T) == 1)
+      {
+        return load(at, value);
+      }
+      else
+      {
+        uint_of<sizeof(T)> bits;
+        load(at, bits);
+        bits = byteswap(bits);
+        std::memcpy(&value, &bits, sizeof(T));
+
+        return sizeof(T);
+      }
+    }
+
+    static std::size_t store_bytes(std::uint8_t* at, const void* from, std::size_t size) noexcept
+    {
+      // memcpy() with a null pointer is undefined even for zero bytes
+      if (size)
+        std::memcpy(at, from, size);
+
+      return size;
+    }
+
+    static std::size_t load_bytes(void* to, const std::uint8_t* at, std::size_t size) noexcept
+    {
+      if (size)
+        std::memcpy(to, at, size);
+
+      return size;
+    }
 
     constexpr bool set_overflow(std::size_t size) noexcept
     {
@@ -77,6 +184,8 @@ namespace elib::data
     template<typename T, std::size_t N>
     constexpr bool set_overflow(const T(&)[N]) noexcept { return set_overflow(N * sizeof(T)); }
 
+    constexpr void mark_overflow() noexcept { overflow_ = true; }
+    constexpr std::size_t remaining() const noexcept { return limit_ - pos_; }
     constexpr void increment(std::size_t n) { pos_ += n; }
     inline byte_pointer current_address() { return bytes_ + pos_;}
   };
@@ -102,49 +211,164 @@ namespace elib::data
 
     }
 
+    /**
+     * @brief Writable window returned by reserve(): its bounds were checked once, writes
+     * into it are unchecked (asserted in debug builds only).
+     */
+    class window
+    {
+    public:
+      constexpr window() = default;
+
+      explicit constexpr operator bool() const noexcept { return valid_; }
+
+      constexpr std::size_t size() const noexcept { return size_; }
+      constexpr std::size_t pos() const noexcept { return pos_; }
+      byte_pointer data() const noexcept { return bytes_; }
+
+      /**
+       * @brief Writes the fields one after another, without bounds checks.
+       * @pre The window is valid and the fields fit into the rest of it.
+       */
+      template<typename... Fields>
+      window& write(const Fields&... fields) noexcept
+      {
+        ELIB_ASSERT_DEBUG(valid_ && pos_ + (size_bytes(fields) + ... + 0) <= size_,
+                          "elib::data::output_stream::window: write past the reserved window");
+
+        ((pos_ += store(bytes_ + pos_, fields)), ...);
+
+        return *this;
+      }
+
+      template<typename T>
+      window& operator<<(const T& field) noexcept
+      {
+        return write(field);
+      }
+
+    private:
+      friend class output_stream;
+
+      window(byte_pointer bytes, std::size_t size) noexcept
+        : bytes_{bytes}
+        , size_{size}
+        , valid_{true}
+      {
+      }
+
+      byte_pointer bytes_{nullptr};
+      std::size_t size_{0};
+      std::size_t pos_{0};
+      bool valid_{false};
+    };
+
     template<typename T, typename = enable_if_trivial<T>>
     bool write(T value)
     {
-      constexpr auto vsize = sizeof(T);
-      if (set_overflow(vsize))
-        return false;
+      return write_all(value);
+    }
 
-      if constexpr (vsize == sizeof(byte))
-        *current_address() = static_cast<byte>(value);
-      else
-        std::memcpy(current_address(), &value, vsize);
+    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
+    bool write(const T(&array)[size])
+    {
+      return write_all(array);
+    }
+
+    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
+    bool write(const std::array<T, size>& array)
+    {
+      return write_all(array);
+    }
+
+    template<typename T, std::size_t Extent, typename = enable_if_trivial<std::remove_const_t<T>>>
+    bool write(span<T, Extent> values)
+    {
+      return write_all(values);
+    }
+
+    /**
+     * @brief Writes all fields (scalars, C arrays, std::array, span) with a single
+     * bounds check for the whole pack.
+     * @return false (and nothing is written) if the pack does not fit.
+     */
+    template<typename... Fields>
+    bool write_all(const Fields&... fields)
+    {
+      if (set_overflow((size_bytes(fields) + ... + 0)))
+        return false;
 
-      increment(vsize);
+      (increment(store(current_address(), fields)), ...);
 
       return true;
     }
 
-    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
-    bool write(const T(&array)[size])
+    /**
+     * @brief Writes a scalar in big-endian (network) byte order.
+     */
+    template<typename T, typename = enable_if_trivial<T>>
+    bool write_be(T value)
+    {
+      return write_ordered<endian::big>(value);
+    }
+
+    /**
+     * @brief Writes a scalar in little-endian byte order.
+     */
+    template<typename T, typename = enable_if_trivial<T>>
+    bool write_le(T value)
     {
-      if (set_overflow(array))
+      return write_ordered<endian::little>(value);
+    }
+
+    /**
+     * @brief Writes an integer as a LEB128 varint (zig-zag encoded if signed), see varint.h.
+     * @return false (and nothing is written) if the encoded value does not fit.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    bool write_varint(T value)
+    {
+      // the exact size is only needed near the end of the buffer
+      if (overflow() || (remaining() < varint_max_size<T> && set_overflow(varint_size(value))))
         return false;
 
-      const std::size_t underlyingSize = size_bytes(array);
-      std::memcpy(current_address(), array, underlyingSize);
-      increment(underlyingSize);
+      increment(varint_encode(current_address(), value));
 
       return true;
     }
 
-    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
-    bool write(const std::array<T, size>& array)
+    /**
+     * @brief Writes a struct described with ELIB_SERIALIZE, see serialize.h. A single
+     * bounds check covers the whole message.
+     * @return false (and nothing is written) if the message does not fit.
+     */
+    template<typename T, std::enable_if_t<is_message_v<T>, int> = 0>
+    bool write(const T& message)
     {
-      if (set_overflow(array))
+      if (set_overflow(serialized_size(message)))
         return false;
 
-      const std::size_t underlyingSize = size_bytes(array);
-      std::memcpy(current_address(), array.data(), underlyingSize);
-      increment(underlyingSize);
+      increment(serialize(current_address(), message));
 
       return true;
     }
 
+    /**
+     * @brief Reserves the next `size` bytes and moves the stream past them.
+     * @return A window for unchecked writes, or an invalid one (overflow is set)
+     * if the bytes do not fit.
+     */
+    window reserve(std::size_t size)
+    {
+      if (set_overflow(size))
+        return window{};
+
+      const window reserved{current_address(), size};
+      increment(size);
+
+      return reserved;
+    }
+
     template<typename T, typename = enable_if_trivial<T>>
     output_stream& operator<<(T value)
     {
@@ -168,6 +392,34 @@ namespace elib::data
 
       return *this;
     }
+
+    template<typename T, std::size_t Extent, typename = enable_if_trivial<std::remove_const_t<T>>>
+    output_stream& operator<<(span<T, Extent> values)
+    {
+      static_cast<void>(write(values));
+
+      return *this;
+    }
+
+    template<typename T, std::enable_if_t<is_message_v<T>, int> = 0>
+    output_stream& operator<<(const T& message)
+    {
+      static_cast<void>(write(message));
+
+      return *this;
+    }
+
+  private:
+    template<endian Order, typename T>
+    bool write_ordered(T value)
+    {
+      if (set_overflow(sizeof(T)))
+        return false;
+
+      increment(store_ordered<Order>(current_address(), value));
+
+      return true;
+    }
   };
 
   class input_stream : public stream_base<true>
@@ -203,49 +455,103 @@ namespace elib::data
     template<typename T, typename = enable_if_trivial<T>>
     bool read(T& value)
     {
-      constexpr auto vsize = sizeof(T);
-      if (set_overflow(vsize))
+      return read_all(value);
+    }
+
+    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
+    bool read(T(&array)[size])
+    {
+      return read_all(array);
+    }
+
+    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
+    bool read(std::array<T, size>& array)
+    {
+      return read_all(array);
+    }
+
+    template<typename T, std::size_t Extent, typename = enable_if_trivial<T>>
+    bool read(span<T, Extent> values)
+    {
+      return read_all(values);
+    }
+
+    /**
+     * @brief Reads all fields (scalars, C arrays, std::array, span) with a single
+     * bounds check for the whole pack.
+     * @return false (and nothing is read) if the stream holds fewer bytes than the pack.
+     */
+    template<typename... Fields>
+    bool read_all(Fields&&... fields)
+    {
+      if (set_overflow((size_bytes(fields) + ... + 0)))
         return false;
 
-      if constexpr (vsize == sizeof(byte))
-      {
-        value = static_cast<T>(*current_address());
-      }
-      else if constexpr (std::is_same_v<T, float>)
-      {
-        value = *(reinterpret_cast<const float*>(current_address()));
-      }
-      else
-      {
-        std::memcpy(&value, current_address(), vsize);
-      }
-      increment(vsize);
+      (increment(load(current_address(), fields)), ...);
 
       return true;
     }
 
-    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
-    bool read(T(&array)[size])
+    /**
+     * @brief Reads a scalar stored in big-endian (network) byte order.
+     */
+    template<typename T, typename = enable_if_trivial<T>>
+    bool read_be(T& value)
+    {
+      return read_ordered<endian::big>(value);
+    }
+
+    /**
+     * @brief Reads a scalar stored in little-endian byte order.
+     */
+    template<typename T, typename = enable_if_trivial<T>>
+    bool read_le(T& value)
+    {
+      return read_ordered<endian::little>(value);
+    }
+
+    /**
+     * @brief Reads a LEB128 varint (zig-zag encoded if T is signed), see varint.h.
+     * @return false if the bytes left are truncated or do not encode a value of type T:
+     * nothing is read and overflow is set.
+     */
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    bool read_varint(T& value)
     {
-      if (set_overflow(array))
+      if (overflow())
         return false;
 
-      const std::size_t underlyingSize = size_bytes(array);
-      std::memcpy(array, current_address(), underlyingSize);
-      increment(underlyingSize);
+      const std::size_t used = varint_decode(current_address(), remaining(), value);
+      if (!used)
+      {
+        mark_overflow();
+        return false;
+      }
+
+      increment(used);
 
       return true;
     }
 
-    template<typename T, std::size_t size, typename = enable_if_trivial<T>>
-    bool read(std::array<T, size>& array)
+    /**
+     * @brief Reads a struct described with ELIB_SERIALIZE, see serialize.h.
+     * @return false if the bytes left are truncated or malformed: nothing is read and
+     * overflow is set, the message may be partially updated.
+     */
+    template<typename T, std::enable_if_t<is_message_v<T>, int> = 0>
+    bool read(T& message)
     {
-      if (set_overflow(array))
+      if (overflow())
         return false;
 
-      const std::size_t underlyingSize = size_bytes(array);
-      std::memcpy(array.data(), current_address(), underlyingSize);
-      increment(underlyingSize);
+      const std::size_t used = deserialize(current_address(), remaining(), message);
+      if (!used)
+      {
+        mark_overflow();
+        return false;
+      }
+
+      increment(used);
 
       return true;
     }
@@ -274,5 +580,33 @@ namespace elib::data
 
       return *this;
     }
+
+    template<typename T, std::size_t Extent, typename = enable_if_trivial<T>>
+    input_stream& operator>>(span<T, Extent> values)
+    {
+      static_cast<void>(read(values));
+
+      return *this;
+    }
+
+    template<typename T, std::enable_if_t<is_message_v<T>, int> = 0>
+    input_stream& operator>>(T& message)
+    {
+      static_cast<void>(read(message));
+
+      return *this;
+    }
+
+  private:
+    template<endian Order, typename T>
+    bool read_ordered(T& value)
+    {
+      if (set_overflow(sizeof(T)))
+        return false;
+
+      increment(load_ordered<Order>(current_address(), value));
+
+      return true;
+    }
   };
 }
\ No newline at end of file
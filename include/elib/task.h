@@ -12,7 +12,15 @@ namespace elib
   class task : public kernel::task_base
   {
   public:
-    task();
+    /**
+     * @param priority Kernel priority band of the task.
+     */
+    explicit task(kernel::priority_type priority = kernel::default_priority);
+
+    /**
+     * @brief Constructs a task that is not registered, for an elib::kernel::static_schedule.
+     */
+    explicit task(kernel::static_dispatch_t);
     virtual ~task() override;
 
     task(const task&) = delete;
@@ -30,7 +38,10 @@ namespace elib
   class manual_task : public kernel::task_base
   {
   public:
-    manual_task() = default;
+    /**
+     * @param priority Kernel priority band used by start().
+     */
+    explicit manual_task(kernel::priority_type priority = kernel::default_priority);
     virtual ~manual_task() override;
 
     manual_task(const manual_task&)            = delete;
@@ -49,6 +60,9 @@ namespace elib
      * @brief Unregisters the task from the kernel.
      */
     void stop();
+
+  private:
+    kernel::priority_type priority_;
   };
 
   /**
@@ -65,9 +79,11 @@ namespace elib
      * @brief Constructs the adapter task.
      * @param handler Reference to the object to adapt.
      * @param autoStart If true (default), attempts to register immediately.
+     * @param priority Kernel priority band of the task.
      */
-    generic_task(Handler& handler, bool autoStart = true)
-      : handler_{handler}
+    generic_task(Handler& handler, bool autoStart = true, kernel::priority_type priority = kernel::default_priority)
+      : manual_task{priority}
+      , handler_{handler}
     {
       if (autoStart)
       {
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <elib/time/tick_math.h>
 
 namespace elib::time
 {
@@ -54,12 +56,12 @@ namespace elib::time
 
     static bool has_paased(const duration_from& duration)
     {
-      return (now() - duration.start) >= duration.interval;
+      return has_passed(duration.start, duration.interval.count());
     }
 
     static bool has_passed(const time_point& start, rep ticks)
     {
-      return (now() - start).count() >= ticks;
+      return ticks_between(start.time_since_epoch().count(), now().time_since_epoch().count()) >= ticks;
     }
 
     static void delay(duration duration)
@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <elib/time/tick_math.h>
+
 namespace elib::time
 {
+  // NOTE: wrap-safe for deadlines less than half the clock counter range ahead
   template<typename Clock>
   class deadline_timer
   {
@@ -43,12 +46,16 @@ namespace elib::time
 
     bool hasExpired() const
     {
-      return deadline_ <= Clock::now();
+      return !tick_before(Clock::now().time_since_epoch().count(), deadline_.time_since_epoch().count());
     }
 
+    // zero once expired
     duration_type remainingTime() const
     {
-      return deadline_ - Clock::now();
+      const tick now = Clock::now().time_since_epoch().count();
+      const tick deadline = deadline_.time_since_epoch().count();
+
+      return tick_before(now, deadline) ? duration_type{ticks_between(now, deadline)} : duration_type::zero();
     }
 
   private:
@@ -7,9 +7,12 @@
 
 #pragma once
 
+#include <elib/time/tick_math.h>
+
 namespace elib::time
 {
-  // NOTE: Pay attention to possible overflows during long intervals with precise clocks
+  // NOTE: wrap-safe, but an interval longer than the clock counter range is lost
+  //       (e.g. ~49.7 days with a 32-bit 1 ms clock, use elib::time::epoch_clock)
   template<typename Clock>
   class elapsed_timer
   {
@@ -44,7 +47,7 @@ namespace elib::time
 
     duration_type elapsed() const
     {
-      return Clock::now() - start_point_;
+      return duration_type{ticks_between(start_point_.time_since_epoch().count(), Clock::now().time_since_epoch().count())};
     }
 
     bool elapsed(duration_type duration) const
@@ -0,0 +1,36 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <elib/time/system_clock.h>
+
+namespace elib::time
+{
+  // 64-bit extension of system_clock: same tick, but never wraps in practice
+  // (2^63 ticks, ~2.9 million years at 100 kHz), for uptimes and long deadlines.
+  //
+  // The tick ISR (system_clock::increment()) keeps a 32-bit count of half-wraps of the
+  // system_clock counter next to it. A reader combines both words and corrects a read
+  // torn by the ISR, so now() needs no critical section and is safe from ISR and task
+  // context on cores without 64-bit atomics (e.g. Cortex-M).
+  class epoch_clock
+  {
+  public:
+    using period                    = system_clock::period;
+    using rep                       = std::uint64_t;
+    using duration                  = std::chrono::duration<rep, period>;
+    using time_point                = std::chrono::time_point<epoch_clock>;
+    static constexpr bool is_steady = false;
+
+    static rep ticks() noexcept;
+
+    static time_point now() noexcept;
+  };
+}
@@ -31,6 +31,11 @@ namespace elib::time
     static void set(rep reps);
     static void reset();
 
+    // Adds `reps` ticks at once, e.g. after a tickless sleep.
+    // NOTE: call while the tick interrupt is stopped; see timer::advance_clock()
+    //       to keep timers firing at their deadlines across the jump.
+    static void advance(rep reps);
+
     static rep ticks() noexcept;
 
     static time_point now() noexcept;
@@ -0,0 +1,41 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <type_traits>
+
+namespace elib::time
+{
+  // Wrap-safe arithmetic on free-running tick counters: results are computed modulo
+  // the counter range, so they stay correct when the counter wraps between `from`
+  // and `to`.
+
+  /**
+   * @brief Ticks from `from` to `to`, valid while less than the full counter range apart.
+   */
+  template<typename Rep>
+  constexpr Rep ticks_between(Rep from, Rep to) noexcept
+  {
+    using urep = std::make_unsigned_t<Rep>;
+
+    return static_cast<Rep>(static_cast<urep>(static_cast<urep>(to) - static_cast<urep>(from)));
+  }
+
+  /**
+   * @brief Checks if tick `lhs` comes before tick `rhs`, valid while they are less
+   * than half the counter range apart.
+   */
+  template<typename Rep>
+  constexpr bool tick_before(Rep lhs, Rep rhs) noexcept
+  {
+    using urep = std::make_unsigned_t<Rep>;
+    using srep = std::make_signed_t<Rep>;
+
+    return static_cast<srep>(static_cast<urep>(static_cast<urep>(lhs) - static_cast<urep>(rhs))) < 0;
+  }
+}
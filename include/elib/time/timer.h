@@ -8,8 +8,9 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
 #include <elib/config.h>
+#include <elib/inplace_function.h>
+#include <elib/kernel.h>
 #include <elib/time/system_clock.h>
 
 namespace elib::time
@@ -19,13 +20,28 @@ namespace elib::time
   public:
     using clock = system_clock;
     using id_type = std::uint32_t;
-    using on_timeout = std::function<void()>;
+    // allocation-free, see config::timer_callback_capacity
+    using on_timeout = inplace_function<void(), config::timer_callback_capacity>;
 
     static timer register_timer(config::time_interval interval, on_timeout callback);
     static bool single_shot(config::time_interval interval, on_timeout callback);
+
+    // Timers that mark a task ready (elib::kernel::notify) on expiry.
+    // NOTE: the task is captured by reference, re-bind with set_callback() if it moves
+    static timer register_timer(config::time_interval interval, kernel::task_base& task);
+    static bool single_shot(config::time_interval interval, kernel::task_base& task);
     static void process_timers();
     static void unregister_timers();
 
+    // Time until the earliest active timer expires: zero if a timer is already due,
+    // clock::duration::max() if no timer is running.
+    static clock::duration next_expiry();
+
+    // Advances the system clock by `elapsed` in bulk (e.g. after a tickless sleep),
+    // stepping through every timer deadline on the way, so callbacks fire in order
+    // and periodic timers keep their phase.
+    static void advance_clock(clock::duration elapsed);
+
     timer();
     ~timer();
 
@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+/**
+ * @file varint.h
+ * @brief LEB128 variable-length integers with zig-zag encoding for signed values.
+ *
+ * Every byte carries 7 value bits (least significant group first) and a continuation
+ * bit (0x80). Small values take a single byte: 0..127, or -64..63 for signed integers,
+ * which are zig-zag mapped (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...) first.
+ * Compatible with Protocol Buffers `uint32/uint64/sint32/sint64` fields.
+ *
+ * Usage Example:
+ * @code
+ * std::uint8_t payload[elib::data::varint_max_size<std::int32_t>];
+ * const std::size_t n = elib::data::varint_encode(payload, std::int32_t{-3}); // 1 byte
+ *
+ * std::int32_t value{};
+ * elib::data::varint_decode(payload, n, value); // returns 1
+ * @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <elib/bit.h>
+
+namespace elib::data
+{
+  /// Maximal encoded size of an integer of type T (e.g. 5 for 32-bit, 10 for 64-bit).
+  template<typename T>
+  inline constexpr std::size_t varint_max_size = (std::numeric_limits<std::make_unsigned_t<T>>::digits + 6) / 7;
+
+  template<typename T>
+  constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+
+    if constexpr (std::is_signed_v<T>)
+      return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value >> (std::numeric_limits<U>::digits - 1)));
+    else
+      return value;
+  }
+
+  template<typename T>
+  constexpr T zigzag_decode(std::make_unsigned_t<T> value) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+
+    if constexpr (std::is_signed_v<T>)
+      return static_cast<T>(static_cast<U>(value >> 1) ^ static_cast<U>(~static_cast<U>(value & 1u) + 1u));
+    else
+      return value;
+  }
+
+  /**
+   * @brief Number of bytes varint_encode() writes for `value`.
+   */
+  template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+  constexpr std::size_t varint_size(T value) noexcept
+  {
+    auto bits = zigzag_encode(value);
+
+    std::size_t size = 1;
+    for (; bits >= 0x80u; bits >>= 7)
+      ++size;
+
+    return size;
+  }
+
+  /**
+   * @brief Encodes `value` to `out`, which must hold varint_max_size<T> bytes (or varint_size(value)).
+   * @return Number of bytes written.
+   */
+  template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+  std::size_t varint_encode(std::uint8_t* out, T value) noexcept
+  {
+    auto bits = zigzag_encode(value);
+
+    std::size_t size = 0;
+    for (; bits >= 0x80u; bits >>= 7)
+      out[size++] = static_cast<std::uint8_t>(bits | 0x80u);
+
+    out[size++] = static_cast<std::uint8_t>(bits);
+
+    return size;
+  }
+
+  namespace impl
+  {
+    // byte-wise decode, any input size
+    template<typename U>
+    std::size_t varint_decode_bytes(const std::uint8_t* in, std::size_t size, U& bits) noexcept
+    {
+      constexpr int digits = std::numeric_limits<U>::digits;
+
+      U result{0};
+      int shift = 0;
+
+      for (std::size_t index = 0; index < size && index < varint_max_size<U>; ++index, shift += 7)
+      {
+        const U group = static_cast<U>(in[index] & 0x7Fu);
+
+        // the last group may only use the bits left in U
+        if (digits - shift < 7 && (group >> (digits - shift)))
+          return 0;
+
+        result = static_cast<U>(result | static_cast<U>(group << shift));
+
+        if (!(in[index] & 0x80u))
+        {
+          bits = result;
+          return index + 1;
+        }
+      }
+
+      return 0; // truncated or too long
+    }
+
+    // branch-light decode of up to 8 bytes (56 value bits) from one 64-bit load:
+    // the terminator is found with a single count-trailing-zeros, the 7-bit groups are
+    // packed together with three mask/shift steps
+    inline std::size_t varint_decode_word(const std::uint8_t* in, std::uint64_t& bits) noexcept
+    {
+      std::uint64_t word;
+      std::memcpy(&word, in, sizeof(word));
+
+      if constexpr (endian::native == endian::big)
+        word = byteswap(word);
+
+      const std::uint64_t stops = ~word & 0x8080808080808080u;
+      if (!stops)
+        return 0;
+
+      const std::size_t size = static_cast<std::size_t>(countr_zero(stops)) / 8 + 1;
+      std::uint64_t value = word & 0x7F7F7F7F7F7F7F7Fu;
+
+      if (size < 8)
+        value &= (std::uint64_t{1} << (8 * size)) - 1;
+
+      value = ((value & 0x7F007F007F007F00u) >> 1) | (value & 0x007F007F007F007Fu);
+      value = ((value & 0x3FFF00003FFF0000u) >> 2) | (value & 0x00003FFF00003FFFu);
+      value = ((value & 0x0FFFFFFF00000000u) >> 4) | (value & 0x000000000FFFFFFFu);
+
+      bits = value;
+      return size;
+    }
+  }
+
+  /**
+   * @brief Decodes a varint from the `size` bytes at `in`.
+   * @return Number of bytes consumed, 0 if the input is truncated, longer than
+   * varint_max_size<T> or the value does not fit into T (`value` is unchanged then).
+   */
+  template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+  std::size_t varint_decode(const std::uint8_t* in, std::size_t size, T& value) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+
+    if (size >= sizeof(std::uint64_t))
+    {
+      std::uint64_t bits{};
+      const std::size_t used = impl::varint_decode_word(in, bits);
+
+      if (used && used <= varint_max_size<U> && bits <= std::numeric_limits<U>::max())
+      {
+        value = zigzag_decode<T>(static_cast<U>(bits));
+        return used;
+      }
+
+      // 9 and 10 byte encodings of 64-bit values
+      if (used || varint_max_size<U> <= sizeof(std::uint64_t))
+        return 0;
+    }
+
+    U bits{};
+    const std::size_t used = impl::varint_decode_bytes(in, size, bits);
+    if (used)
+      value = zigzag_decode<T>(bits);
+
+    return used;
+  }
+}
@@ -19,13 +19,26 @@ HEADERS += \
     $$PWD/../include/elib/time/core_clock.h \
     $$PWD/../include/elib/time/deadline_timer.h \
     $$PWD/../include/elib/time/elapsed_timer.h \
+    $$PWD/../include/elib/time/epoch_clock.h \
     $$PWD/../include/elib/time/system_clock.h \
+    $$PWD/../include/elib/time/tick_math.h \
     $$PWD/../include/elib/time/timer.h \
     $$PWD/../include/elib/utility.h \
     $$PWD/../include/elib/version.h \
     $$PWD/../include/elib/kernel.h \
     $$PWD/../include/elib/task.h \
     $$PWD/../include/elib/list.h \
+    $$PWD/../include/elib/mpsc_ring.h \
+    $$PWD/../include/elib/spsc_ring.h \
+    $$PWD/../include/elib/static_schedule.h \
+    $$PWD/../include/elib/co_task.h \
+    $$PWD/../include/elib/bit.h \
+    $$PWD/../include/elib/varint.h \
+    $$PWD/../include/elib/serialize.h \
+    $$PWD/../include/elib/ring_stream.h \
+    $$PWD/../include/elib/host/executor.h \
+
+linux: HEADERS += $$PWD/../include/elib/host/mirrored_ring.h
 
 SOURCES += \
     $$PWD/../src/kernel.cpp \
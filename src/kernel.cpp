@@ -3,85 +3,337 @@
 #include <elib/time/timer.h>
 #include <array>
 #include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
 
 namespace elib::kernel
 {
-  std::array<task_base*, kernel::config::max_task_num + event::config::max_event_loop_num> tasks{};
+  static_assert(config::priority_levels >= 1 && config::priority_levels <= 32,
+                "elib::kernel: priority_levels must be in range [1, 32]");
+
+  constexpr std::size_t registry_size = kernel::config::max_task_num + event::config::max_event_loop_num;
+  constexpr std::size_t no_slot = registry_size;
 
-  bool register_task(task_base& task)
+  // registry slot, ready slots of the same priority band are linked into a circular list,
+  // free slots are linked into the free list through `next`
+  struct task_slot
   {
-    auto it = std::find(tasks.begin(), tasks.end(), &task);
-    if (it != tasks.end())
-      return true; // task already registered, duplicates are not allowed
+    task_base* task{nullptr};
+    std::size_t band{0};
+    bool ready{false};
+    std::size_t next{no_slot};
+    std::size_t prev{no_slot};
+    std::size_t dense_pos{no_slot}; // position in `registered`
+  };
+
+  std::array<task_slot, registry_size> tasks{};
+
+  // free slots: released ones are linked from `free_slot`, untouched ones start at `used_slots`
+  std::size_t free_slot{no_slot};
+  std::size_t used_slots{0};
+
+  // indices of occupied slots, packed, for scans that must visit every task
+  std::array<std::size_t, registry_size> registered{};
+  std::size_t registered_num{0};
+
+  // per-slot statistics, no storage unless enabled
+  std::array<task_stats, config::task_stats ? registry_size : 0> stats{};
 
-    // find empty slot
-    for (auto& slot : tasks)
+  // next slot to run in every band (no_slot if the band is empty)
+  std::array<std::size_t, config::priority_levels> band_cursor = [] {
+    std::array<std::size_t, config::priority_levels> cursors{};
+    cursors.fill(no_slot);
+    return cursors;
+  }();
+
+  // bit N is set while band N has at least one ready task
+  std::uint32_t active_bands{0};
+
+  // set by notify(), tells the kernel to look for notified tasks
+  std::atomic<bool> notify_pending{false};
+
+  template<typename Counter = config::task_stats_counter>
+  std::uint32_t stats_now()
+  {
+    if constexpr (std::is_void_v<Counter>)
+      return static_cast<std::uint32_t>(elib::time::system_clock::ticks());
+    else
+      return static_cast<std::uint32_t>(Counter::get());
+  }
+
+  void record_stats([[maybe_unused]] std::size_t index, [[maybe_unused]] std::uint32_t start)
+  {
+    if constexpr (config::task_stats)
     {
-      if (slot == nullptr)
-      {
-        slot = &task;
-        return true;
-      }
+      // unsigned difference is wrap-safe
+      const std::uint32_t elapsed = stats_now() - start;
+      task_stats& slot_stats = stats[index];
+
+      ++slot_stats.run_count;
+      slot_stats.total_ticks += elapsed;
+      slot_stats.max_ticks = std::max(slot_stats.max_ticks, elapsed);
+
+      if (config::task_slice_budget && elapsed > config::task_slice_budget)
+        ++slot_stats.overruns;
+    }
+  }
+
+  std::size_t highest_band(std::uint32_t bands)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - static_cast<std::size_t>(__builtin_clz(bands));
+#elif defined(_MSC_VER)
+    unsigned long index{};
+    _BitScanReverse(&index, bands);
+    return index;
+#else
+    std::size_t index = 0;
+    while (bands >>= 1)
+      ++index;
+    return index;
+#endif
+  }
+
+  std::size_t find_slot(task_base& task)
+  {
+    const std::size_t index = impl::registry_slot(task);
+    if (index < tasks.size() && tasks[index].task == &task)
+      return index;
+
+    return no_slot;
+  }
+
+  std::size_t acquire_slot()
+  {
+    if (free_slot != no_slot)
+    {
+      const std::size_t index = free_slot;
+      free_slot = tasks[index].next;
+      tasks[index].next = no_slot;
+      return index;
+    }
+
+    return used_slots < tasks.size() ? used_slots++ : no_slot;
+  }
+
+  void release_slot(std::size_t index)
+  {
+    // swap-remove from the dense list
+    const std::size_t pos = tasks[index].dense_pos;
+    const std::size_t last = registered[--registered_num];
+    registered[pos] = last;
+    tasks[last].dense_pos = pos;
+
+    tasks[index] = task_slot{};
+    tasks[index].next = free_slot;
+    free_slot = index;
+  }
+
+  void link_slot(std::size_t index)
+  {
+    task_slot& slot = tasks[index];
+    std::size_t& cursor = band_cursor[slot.band];
+
+    slot.ready = true;
+
+    if (cursor == no_slot)
+    {
+      slot.next = slot.prev = index;
+      cursor = index;
+      active_bands |= (std::uint32_t{1} << slot.band);
+      return;
+    }
+
+    // insert right before the cursor, i.e. at the end of the current round
+    slot.next = cursor;
+    slot.prev = tasks[cursor].prev;
+    tasks[slot.prev].next = index;
+    tasks[cursor].prev = index;
+  }
+
+  void unlink_slot(std::size_t index)
+  {
+    task_slot& slot = tasks[index];
+    std::size_t& cursor = band_cursor[slot.band];
+
+    slot.ready = false;
+
+    if (slot.next == index)
+    {
+      cursor = no_slot;
+      active_bands &= ~(std::uint32_t{1} << slot.band);
+    }
+    else
+    {
+      tasks[slot.prev].next = slot.next;
+      tasks[slot.next].prev = slot.prev;
+
+      if (cursor == index)
+        cursor = slot.next;
     }
 
-    return false;
+    slot.next = slot.prev = no_slot;
+  }
+
+  void dispatch_notifications()
+  {
+    if (!notify_pending.load())
+      return;
+
+    // clear before scanning: a notification raised during the scan is picked up next time
+    notify_pending.store(false);
+
+    for (std::size_t pos = 0; pos < registered_num; ++pos)
+    {
+      const std::size_t index = registered[pos];
+      task_slot& slot = tasks[index];
+      if (impl::consume_notification(*slot.task) && !slot.ready)
+        link_slot(index);
+    }
+  }
+
+  bool register_task(task_base& task, priority_type priority)
+  {
+    if (find_slot(task) != no_slot)
+      return true; // task already registered, duplicates are not allowed
+
+    const std::size_t index = acquire_slot();
+    if (index == no_slot)
+      return false;
+
+    task_slot& slot = tasks[index];
+    slot.task = &task;
+    slot.band = std::min<std::size_t>(priority, config::priority_levels - 1);
+    slot.dense_pos = registered_num;
+    registered[registered_num++] = index;
+    impl::registry_slot(task) = index;
+
+    if constexpr (config::task_stats)
+      stats[index] = task_stats{};
+
+    link_slot(index);
+    return true;
   }
 
   void unregister_task(task_base& task)
   {
-    for (auto& slot : tasks)
+    const std::size_t index = find_slot(task);
+    if (index == no_slot)
+      return;
+
+    if (tasks[index].ready)
+      unlink_slot(index);
+
+    release_slot(index);
+    impl::registry_slot(task) = no_slot;
+  }
+
+  void notify(task_base& task)
+  {
+    task.notified_.store(true);
+    notify_pending.store(true);
+  }
+
+  void suspend(task_base& task)
+  {
+    const std::size_t index = find_slot(task);
+    if (index != no_slot && tasks[index].ready)
+      unlink_slot(index);
+  }
+
+  idle_state idle_hint()
+  {
+    return idle_state{active_bands != 0 || notify_pending.load(), elib::time::timer::next_expiry()};
+  }
+
+  void visit_stats(function_ref<void(const task_base&, const task_stats&)> visitor)
+  {
+    if constexpr (config::task_stats)
     {
-      if (slot == &task)
+      for (std::size_t pos = 0; pos < registered_num; ++pos)
       {
-        slot = nullptr;
-        return;
+        const std::size_t index = registered[pos];
+        visitor(*tasks[index].task, stats[index]);
       }
     }
   }
 
+  void reset_stats()
+  {
+    stats.fill(task_stats{});
+  }
+
   std::size_t task_max_num()
   {
     return tasks.max_size();
   }
-  
+
   void impl::move_task(task_base& from, task_base& to)
   {
-    for (auto& slot : tasks)
+    to.notified_.store(from.notified_.load());
+
+    const std::size_t index = find_slot(from);
+    if (index != no_slot)
     {
-      if (slot == &from)
-      {
-        slot = &to;
-        return;
-      }
+      tasks[index].task = &to;
+      impl::registry_slot(to) = index;
+      impl::registry_slot(from) = no_slot;
     }
   }
 
-  void process_tasks()
+  std::size_t& impl::registry_slot(task_base& task)
+  {
+    return task.slot_;
+  }
+
+  bool impl::consume_notification(task_base& task)
+  {
+    if (!task.notified_.load())
+      return false;
+
+    task.notified_.store(false);
+    return true;
+  }
+
+  bool process_tasks()
   {
-    static std::size_t current_index = 0;
-    const std::size_t initial_index = current_index;
+    dispatch_notifications();
+
+    if (!active_bands)
+      return false;
 
-    do
+    std::size_t& cursor = band_cursor[highest_band(active_bands)];
+    const std::size_t index = cursor;
+    task_base* task = tasks[index].task;
+
+    // advance the band cursor before running: the task may unregister itself
+    cursor = tasks[index].next;
+
+    if constexpr (config::task_stats)
     {
-      auto& task = tasks[current_index];
+      const std::uint32_t start = stats_now();
+      task->run();
 
-      // advance current index
-      if (++current_index >= tasks.size())
-      {
-        current_index = 0;
-      }
+      // the slot was released (or reused) while running, the slice belongs to nobody
+      if (tasks[index].task == task)
+        record_stats(index, start);
+    }
+    else
+    {
+      task->run();
+    }
 
-      if (task)
-      {
-        return task->run();
-      }
-    } while (current_index != initial_index);
+    return true;
   }
 
-  void process_all()
+  bool process_all()
   {
     elib::time::timer::process_timers();
 
-    process_tasks();
+    return process_tasks();
   }
-}
\ No newline at end of file
+}
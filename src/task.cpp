@@ -2,13 +2,17 @@
 
 namespace elib
 {
-  task::task()
+  task::task(kernel::priority_type priority)
   {
-    [[maybe_unused]] const bool result = kernel::register_task(*this);
+    [[maybe_unused]] const bool result = kernel::register_task(*this, priority);
 
     ELIB_ASSERT(result, "elib::task: unable to register task! Try to increase maximum number of active tasks.");
   }
 
+  task::task(kernel::static_dispatch_t)
+  {
+  }
+
   task::~task()
   {
     kernel::unregister_task(*this);
@@ -31,12 +35,18 @@ namespace elib
   }
 
 
+  manual_task::manual_task(kernel::priority_type priority)
+    : priority_{priority}
+  {
+  }
+
   manual_task::~manual_task()
   {
     kernel::unregister_task(*this);
   }
 
   manual_task::manual_task(manual_task&& other)
+    : priority_{other.priority_}
   {
     kernel::impl::move_task(other, *this);
   }
@@ -47,6 +57,7 @@ namespace elib
     {
       kernel::unregister_task(*this);
       kernel::impl::move_task(other, *this);
+      priority_ = other.priority_;
     }
 
     return *this;
@@ -54,7 +65,7 @@ namespace elib
 
   bool manual_task::start()
   {
-    const bool result = kernel::register_task(*this);
+    const bool result = kernel::register_task(*this, priority_);
 
     return result;
   }
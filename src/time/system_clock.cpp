@@ -1,22 +1,53 @@
 #include <elib/time/system_clock.h>
+#include <elib/time/epoch_clock.h>
+#include <elib/time/tick_math.h>
+#include <limits>
 
 namespace elib::time
 {
+  constexpr int tick_bits = std::numeric_limits<system_clock::rep>::digits;
+  constexpr bool tick_extended = tick_bits < std::numeric_limits<epoch_clock::rep>::digits;
+  constexpr system_clock::rep tick_half = system_clock::rep{1} << (tick_bits - 1);
+
   static volatile system_clock::rep sys_clock_tick = 0;
 
+  // number of times sys_clock_tick crossed a half of its range (epoch_clock::ticks() >> (tick_bits - 1)),
+  // always written after sys_clock_tick, so a reader sees it lag by at most one
+  static volatile std::uint32_t sys_clock_half_wraps = 0;
+
+  static void set_epoch_ticks(epoch_clock::rep ticks)
+  {
+    sys_clock_tick = static_cast<system_clock::rep>(ticks);
+
+    if constexpr (tick_extended)
+      sys_clock_half_wraps = static_cast<std::uint32_t>(ticks >> (tick_bits - 1));
+  }
+
   void system_clock::increment()
   {
-    ++sys_clock_tick;
+    const rep tick = static_cast<rep>(sys_clock_tick + 1);
+    sys_clock_tick = tick;
+
+    if constexpr (tick_extended)
+    {
+      if (static_cast<rep>(tick & (tick_half - 1)) == 0)
+        sys_clock_half_wraps = sys_clock_half_wraps + 1;
+    }
   }
 
   void system_clock::set(rep reps)
   {
-    sys_clock_tick = reps;
+    set_epoch_ticks(reps);
+  }
+
+  void system_clock::advance(rep reps)
+  {
+    set_epoch_ticks(epoch_clock::ticks() + reps);
   }
 
   void system_clock::reset()
   {
-    sys_clock_tick = 0;
+    set_epoch_ticks(0);
   }
 
   system_clock::rep system_clock::ticks() noexcept
@@ -36,11 +67,36 @@ namespace elib::time
 
   bool system_clock::has_passed(const duration_from& duration)
   {
-    return (now() - duration.start) >= duration.interval;
+    return has_passed(duration.start, duration.interval.count());
   }
 
   bool system_clock::has_passed(const time_point& start, rep ticks)
   {
-    return (now() - start).count() >= ticks;
+    return ticks_between(start.time_since_epoch().count(), sys_clock_tick) >= ticks;
+  }
+
+  epoch_clock::rep epoch_clock::ticks() noexcept
+  {
+    if constexpr (tick_extended)
+    {
+      // half-wrap count first: the tick read after it is never older
+      std::uint32_t half_wraps = sys_clock_half_wraps;
+      const system_clock::rep tick = sys_clock_tick;
+
+      // parity of the count mismatches the tick msb while the ISR has not published it yet
+      if (((half_wraps & 1u) != 0) != ((tick & tick_half) != 0))
+        ++half_wraps;
+
+      return (rep{half_wraps >> 1} << tick_bits) | tick;
+    }
+    else
+    {
+      return sys_clock_tick;
+    }
+  }
+
+  epoch_clock::time_point epoch_clock::now() noexcept
+  {
+    return time_point{duration{ticks()}};
   }
 }
@@ -1,134 +1,69 @@
 #include <elib/time/timer.h>
 
-#include <array>
-#include <numeric>
+#include <algorithm>
 #include <utility>
 
-#include <elib/assert.h>
-#include <elib/time/system_clock.h>
-#include <elib/time/elapsed_timer.h>
+#include "timer_engine.h"
 
 namespace elib::time
 {
-  constexpr timer::id_type empty_timer_id = std::numeric_limits<timer::id_type>::max();
+  constexpr timer::id_type empty_timer_id = detail::timer_engine<config::timer_backend_type, config::max_timer_num>::empty_id;
 
-  struct timer_handle
-  {
-    bool registered{false};
-    bool active{false};
-    bool single_shot{false};
-    config::time_interval interval{0};
-    elapsed_timer<timer::clock> elapsed;
-    timer::on_timeout callback;
-  };
-
-  std::array<timer_handle, config::max_timer_num> timers{};
+  detail::timer_engine<config::timer_backend_type, config::max_timer_num> engine{};
 
-  timer_handle &get_handle(std::size_t index)
+  timer timer::register_timer(config::time_interval interval, on_timeout callback)
   {
-    static timer_handle invalid{};
-
-    ELIB_ASSERT_DEBUG(index < timers.size(), "elib::time::timer: timer ID out of bounds!");
+    const timer::id_type tid = engine.register_timer(interval, std::move(callback), false);
 
-    if (index >= timers.size())
-    {
-      invalid.registered = false;
-      return invalid;
-    }
-
-    return timers[index];
+    return timer{tid};
   }
 
-  timer::id_type registerTimerImpl(config::time_interval interval, timer::on_timeout callback, bool singleShot = false)
+  bool timer::single_shot(config::time_interval interval, on_timeout callback)
   {
-    // NOTE: make sure timer::id_type type can represent entire timers range
-    static_assert(config::max_timer_num <= std::numeric_limits<timer::id_type>::max());
-
-    for (std::size_t index{0}; index < timers.size(); index++)
-    {
-      timer_handle &timer = timers[index];
-      if (!timer.registered)
-      {
-        timer.callback = std::move(callback);
-        timer.interval = interval;
-        timer.single_shot = singleShot;
-        timer.registered = true;
-
-        return static_cast<timer::id_type>(index);
-      }
-    }
+    const timer::id_type tid = engine.register_timer(interval, std::move(callback), true);
 
-    ELIB_ASSERT_DEBUG(false, "elib::time::timer: maximum active timer number overflow! Increase elib::config::max_timer_num");
-
-    return empty_timer_id;
+    return tid != empty_timer_id;
   }
 
-  timer timer::register_timer(config::time_interval interval, on_timeout callback)
+  timer timer::register_timer(config::time_interval interval, kernel::task_base& task)
   {
-    const timer::id_type tid = registerTimerImpl(interval, std::move(callback));
-
-    return timer{tid};
+    return register_timer(interval, [&task]() { kernel::notify(task); });
   }
 
-  bool timer::single_shot(config::time_interval interval, on_timeout callback)
+  bool timer::single_shot(config::time_interval interval, kernel::task_base& task)
   {
-    const timer::id_type tid = registerTimerImpl(interval, std::move(callback), true);
-    const bool success = tid != empty_timer_id;
-
-    if (success)
-    {
-      get_handle(tid).active = true;
-    }
-
-    return success;
+    return single_shot(interval, [&task]() { kernel::notify(task); });
   }
 
   void timer::process_timers()
   {
-    static std::size_t curr_index = 0;
-    const std::size_t init_index = curr_index;
-
-    do
-    {
-      timer_handle &curr_timer = timers[curr_index];
-
-      // advance current index
-      if (++curr_index >= timers.size())
-      {
-        curr_index = 0;
-      }
-
-      if (curr_timer.registered &&
-          curr_timer.callback &&
-          curr_timer.active &&
-          curr_timer.elapsed.elapsed(curr_timer.interval))
-      {
-        curr_timer.callback();
-        curr_timer.elapsed.reset();
-
-        if (curr_timer.single_shot)
-        {
-          curr_timer.registered = false;
-          curr_timer.active = false;
-        }
-        return;
-      }
-    } while (curr_index != init_index);
+    engine.process_timers();
   }
 
   void timer::unregister_timers()
   {
-    for (timer_handle& timer : timers)
-      timer = timer_handle{};
+    engine.unregister_timers();
   }
 
+  timer::clock::duration timer::next_expiry()
+  {
+    return engine.next_expiry();
+  }
 
-  void unregister_timer(timer::id_type id)
+  void timer::advance_clock(clock::duration elapsed)
   {
-    if (id >= timers.size())
-      return;
+    constexpr clock::duration min_step{1};
+
+    while (elapsed.count() > 0)
+    {
+      const clock::duration step = std::clamp(engine.next_expiry(), min_step, elapsed);
+      clock::advance(step.count());
+      elapsed -= step;
 
-    get_handle(id) = timer_handle{};
+      // fire everything that is due at this point in time
+      for (std::size_t count = 0; count < config::max_timer_num && engine.next_expiry().count() == 0; ++count)
+        engine.process_timers();
+    }
   }
 
   timer::timer()
@@ -166,18 +101,17 @@ namespace elib::time
 
   void timer::set_interval(config::time_interval interval)
   {
-    get_handle(id_).interval = interval;
+    engine.set_interval(id_, interval);
   }
 
   config::time_interval timer::interval() const
   {
-    return get_handle(id_).interval;
+    return engine.interval(id_);
   }
 
   void timer::set_callback(on_timeout callback)
   {
-    if (valid())
-      get_handle(id_).callback = std::move(callback);
+    engine.set_callback(id_, std::move(callback));
   }
 
   timer::id_type timer::id() const
@@ -187,35 +121,27 @@ namespace elib::time
 
   void timer::start()
   {
-    timer_handle &thandle = get_handle(id_);
-    thandle.active = true;
-    thandle.elapsed.start();
+    engine.start(id_);
   }
 
   void timer::stop()
   {
-    get_handle(id_).active = false;
+    engine.stop(id_);
   }
 
   bool timer::running() const
   {
-    if (valid())
-      return get_handle(id_).active;
-
-    return false;
+    return engine.running(id_);
   }
 
   bool timer::valid() const
   {
-    if (id_ != empty_timer_id)
-      return get_handle(id_).registered;
-
-    return false;
+    return engine.valid(id_);
   }
 
   void timer::unregister()
   {
-    unregister_timer(id_);
+    engine.unregister_timer(id_);
     id_ = empty_timer_id;
   }
-}
\ No newline at end of file
+}
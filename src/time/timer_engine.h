@@ -0,0 +1,411 @@
+/////////////////////////////////////////////////////////////
+//          Copyright Vadym Senkiv 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+/////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <elib/assert.h>
+#include <elib/config.h>
+#include <elib/time/tick_math.h>
+#include <elib/time/timer.h>
+
+namespace elib::time::detail
+{
+  /**
+   * @brief Storage and dispatch of elib::time::timer handles (library internal).
+   *
+   * Every active timer has an absolute expiry tick, periodic timers advance it by their
+   * interval (drift-free), missed periods are handled according to CatchUp.
+   *
+   * @tparam Backend    linear_scan: round-robin scan, at most one expired timer per process_timers()
+   *                    unless FireAllDue.
+   *                    min_heap: min-heap of active timers ordered by absolute expiry tick,
+   *                    every due timer fires in one process_timers().
+   * @tparam Capacity   Maximum number of registered timers.
+   * @tparam CatchUp    Policy for periodic timers that missed whole periods.
+   * @tparam FireAllDue linear_scan: fire every due timer in one process_timers().
+   */
+  template<config::timer_backend Backend, std::size_t Capacity,
+           config::timer_catch_up CatchUp = config::timer_catch_up_policy,
+           bool FireAllDue = config::fire_all_due_timers>
+  class timer_engine
+  {
+  public:
+    using clock   = timer::clock;
+    using tick    = clock::rep;
+    using id_type = timer::id_type;
+
+    static constexpr id_type empty_id = std::numeric_limits<id_type>::max();
+
+    // NOTE: make sure timer::id_type type can represent entire timers range
+    static_assert(Capacity <= std::numeric_limits<id_type>::max());
+
+    id_type register_timer(config::time_interval interval, timer::on_timeout callback, bool single_shot)
+    {
+      for (std::size_t index{0}; index < timers_.size(); index++)
+      {
+        handle &timer = timers_[index];
+        if (!timer.registered)
+        {
+          timer.callback = std::move(callback);
+          timer.interval = interval;
+          timer.single_shot = single_shot;
+          timer.registered = true;
+
+          // single-shot timers run from the moment they are registered
+          if (single_shot)
+            start(index);
+
+          return static_cast<id_type>(index);
+        }
+      }
+
+      ELIB_ASSERT_DEBUG(false, "elib::time::timer: maximum active timer number overflow! Increase elib::config::max_timer_num");
+
+      return empty_id;
+    }
+
+    void unregister_timer(std::size_t index)
+    {
+      if (index >= timers_.size())
+        return;
+
+      queue_erase(index);
+      get_handle(index) = handle{};
+    }
+
+    void unregister_timers()
+    {
+      for (handle &timer : timers_)
+        timer = handle{};
+
+      heap_size_ = 0;
+    }
+
+    void start(std::size_t index)
+    {
+      handle &timer = get_handle(index);
+      timer.active = true;
+      timer.deadline = static_cast<tick>(clock::ticks() + to_ticks(timer.interval));
+
+      if constexpr (use_heap)
+      {
+        if (timer.registered)
+          queue_push_or_update(index);
+      }
+    }
+
+    void stop(std::size_t index)
+    {
+      get_handle(index).active = false;
+      queue_erase(index);
+    }
+
+    void set_interval(std::size_t index, config::time_interval interval)
+    {
+      handle &timer = get_handle(index);
+
+      // keep the original start point, move the deadline by the interval difference
+      if (timer.active)
+        timer.deadline = static_cast<tick>(timer.deadline - to_ticks(timer.interval) + to_ticks(interval));
+
+      timer.interval = interval;
+
+      if constexpr (use_heap)
+      {
+        if (timer.heap_index != not_queued)
+          queue_update(index);
+      }
+    }
+
+    config::time_interval interval(std::size_t index) const
+    {
+      return get_handle(index).interval;
+    }
+
+    void set_callback(id_type id, timer::on_timeout callback)
+    {
+      if (valid(id))
+        get_handle(id).callback = std::move(callback);
+    }
+
+    bool running(id_type id) const
+    {
+      if (valid(id))
+        return get_handle(id).active;
+
+      return false;
+    }
+
+    bool valid(id_type id) const
+    {
+      if (id != empty_id)
+        return get_handle(id).registered;
+
+      return false;
+    }
+
+    // time until the earliest active deadline, zero if due, max() if nothing is running
+    clock::duration next_expiry() const
+    {
+      const tick now = clock::ticks();
+
+      if constexpr (use_heap)
+      {
+        if (!heap_size_)
+          return clock::duration::max();
+
+        return remaining(now, timers_[heap_.front()].deadline);
+      }
+      else
+      {
+        auto next = clock::duration::max();
+        for (const handle &timer : timers_)
+        {
+          if (timer.registered && timer.active && timer.callback)
+            next = std::min(next, remaining(now, timer.deadline));
+        }
+
+        return next;
+      }
+    }
+
+    void process_timers()
+    {
+      if constexpr (use_heap)
+        process_due_timers();
+      else
+        process_next_timers();
+    }
+
+  private:
+    static constexpr bool use_heap = Backend == config::timer_backend::min_heap;
+    static constexpr std::size_t not_queued = Capacity;
+
+    struct handle
+    {
+      bool registered{false};
+      bool active{false};
+      bool single_shot{false};
+      config::time_interval interval{0};
+      tick deadline{0};                   // absolute expiry tick
+      std::size_t heap_index{not_queued}; // min_heap: position in heap_
+      timer::on_timeout callback;
+    };
+
+    std::array<handle, Capacity> timers_{};
+    handle invalid_{};
+    std::size_t curr_index_{0};
+
+    std::array<std::size_t, Capacity> heap_{};
+    std::size_t heap_size_{0};
+
+    handle &get_handle(std::size_t index)
+    {
+      ELIB_ASSERT_DEBUG(index < timers_.size(), "elib::time::timer: timer ID out of bounds!");
+
+      if (index >= timers_.size())
+      {
+        invalid_.registered = false;
+        return invalid_;
+      }
+
+      return timers_[index];
+    }
+
+    const handle &get_handle(std::size_t index) const
+    {
+      return const_cast<timer_engine &>(*this).get_handle(index);
+    }
+
+    // rounded up: with a clock tick that does not divide the interval (e.g. 32768 Hz)
+    // a timer fires late by less than a tick, never early
+    static tick to_ticks(config::time_interval interval)
+    {
+      return static_cast<tick>(std::chrono::ceil<clock::duration>(interval).count());
+    }
+
+    // wrap-safe "lhs is before rhs" for deadlines less than half the tick range apart
+    static bool earlier(tick lhs, tick rhs)
+    {
+      return tick_before(lhs, rhs);
+    }
+
+    static clock::duration remaining(tick now, tick deadline)
+    {
+      return clock::duration{earlier(now, deadline) ? ticks_between(now, deadline) : tick{0}};
+    }
+
+    // linear_scan: fire the next expired timer (every expired one if FireAllDue) in round-robin order
+    void process_next_timers()
+    {
+      const tick now = clock::ticks();
+      const std::size_t init_index = curr_index_;
+
+      do
+      {
+        const std::size_t index = curr_index_;
+        const handle &curr_timer = timers_[index];
+
+        // advance current index
+        if (++curr_index_ >= timers_.size())
+        {
+          curr_index_ = 0;
+        }
+
+        if (curr_timer.registered &&
+            curr_timer.callback &&
+            curr_timer.active &&
+            !earlier(now, curr_timer.deadline))
+        {
+          fire(index, now);
+
+          if constexpr (!FireAllDue)
+            return;
+        }
+      } while (curr_index_ != init_index);
+    }
+
+    // min_heap: fire every timer whose deadline has been reached
+    void process_due_timers()
+    {
+      const tick now = clock::ticks();
+
+      // bounded: callbacks may (re)start timers that are already due
+      for (std::size_t fired = 0; fired < Capacity && heap_size_ && !earlier(now, timers_[heap_.front()].deadline); ++fired)
+        fire(heap_.front(), now);
+    }
+
+    void fire(std::size_t index, tick now)
+    {
+      handle &timer = timers_[index];
+
+      if (timer.single_shot)
+      {
+        // release the slot first, the callback may register a new timer
+        timer::on_timeout callback = std::move(timer.callback);
+        unregister_timer(index);
+
+        if (callback)
+          callback();
+
+        return;
+      }
+
+      // reschedule from the previous deadline, not from `now`: dispatch lag does not accumulate
+      const tick period = std::max(to_ticks(timer.interval), tick{1});
+      const tick missed = static_cast<tick>(ticks_between(timer.deadline, now) / period);
+      tick calls = 1;
+
+      if constexpr (CatchUp == config::timer_catch_up::fire_once)
+      {
+        timer.deadline = static_cast<tick>(missed ? now + period : timer.deadline + period);
+      }
+      else
+      {
+        timer.deadline = static_cast<tick>(timer.deadline + (missed + 1) * period);
+
+        if constexpr (CatchUp == config::timer_catch_up::fire_all)
+          calls = static_cast<tick>(missed + 1);
+      }
+
+      if constexpr (use_heap)
+        queue_update(index);
+
+      // the callback may stop or unregister its own timer
+      for (; calls && timer.registered && timer.active && timer.callback; --calls)
+        timer.callback();
+    }
+
+    void queue_place(std::size_t pos, std::size_t index)
+    {
+      heap_[pos] = index;
+      timers_[index].heap_index = pos;
+    }
+
+    bool queue_less(std::size_t lhs_pos, std::size_t rhs_pos) const
+    {
+      return earlier(timers_[heap_[lhs_pos]].deadline, timers_[heap_[rhs_pos]].deadline);
+    }
+
+    void queue_swap(std::size_t lhs_pos, std::size_t rhs_pos)
+    {
+      const std::size_t lhs = heap_[lhs_pos];
+      queue_place(lhs_pos, heap_[rhs_pos]);
+      queue_place(rhs_pos, lhs);
+    }
+
+    std::size_t queue_sift_up(std::size_t pos)
+    {
+      while (pos > 0)
+      {
+        const std::size_t parent = (pos - 1) / 2;
+        if (!queue_less(pos, parent))
+          break;
+
+        queue_swap(pos, parent);
+        pos = parent;
+      }
+
+      return pos;
+    }
+
+    void queue_sift_down(std::size_t pos)
+    {
+      for (;;)
+      {
+        const std::size_t left = 2 * pos + 1;
+        if (left >= heap_size_)
+          return;
+
+        const std::size_t right = left + 1;
+        const std::size_t child = (right < heap_size_ && queue_less(right, left)) ? right : left;
+        if (!queue_less(child, pos))
+          return;
+
+        queue_swap(pos, child);
+        pos = child;
+      }
+    }
+
+    void queue_update(std::size_t index)
+    {
+      queue_sift_down(queue_sift_up(timers_[index].heap_index));
+    }
+
+    void queue_push_or_update(std::size_t index)
+    {
+      if (timers_[index].heap_index != not_queued)
+        return queue_update(index);
+
+      queue_place(heap_size_, index);
+      queue_sift_up(heap_size_++);
+    }
+
+    void queue_erase(std::size_t index)
+    {
+      if (!use_heap || index >= timers_.size() || timers_[index].heap_index == not_queued)
+        return;
+
+      const std::size_t pos = timers_[index].heap_index;
+      timers_[index].heap_index = not_queued;
+
+      if (pos == --heap_size_)
+        return;
+
+      queue_place(pos, heap_[heap_size_]);
+      queue_sift_down(queue_sift_up(pos));
+    }
+  };
+}
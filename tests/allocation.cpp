@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h> // _aligned_malloc
+#endif
+
+#include <elib/event_loop.h>
+#include <elib/time/system_clock.h>
+#include <elib/time/timer.h>
+
+// Replaces the global allocation functions of the test binary to count heap use. Every
+// new/delete pair (plain, sized, nothrow, aligned) is replaced, so that allocations made by
+// the test framework never mix the library allocator with the replaced delete.
+namespace
+{
+    std::atomic<std::size_t> allocation_num{0};
+
+    void* counted_alloc(std::size_t size) noexcept
+    {
+        allocation_num.fetch_add(1, std::memory_order_relaxed);
+
+        return std::malloc(size ? size : 1);
+    }
+
+    void* counted_alloc(std::size_t size, std::align_val_t alignment) noexcept
+    {
+        allocation_num.fetch_add(1, std::memory_order_relaxed);
+
+        const auto align = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        // aligned_alloc() needs a size that is a multiple of the alignment
+        return std::aligned_alloc(align, size ? (size + align - 1) / align * align : align);
+#endif
+    }
+
+    void aligned_free(void* ptr) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    template<typename... Alignment>
+    void* checked_alloc(std::size_t size, Alignment... alignment)
+    {
+        if (void* ptr = counted_alloc(size, alignment...))
+            return ptr;
+
+        throw std::bad_alloc{};
+    }
+}
+
+void* operator new(std::size_t size) { return checked_alloc(size); }
+void* operator new[](std::size_t size) { return checked_alloc(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) { return checked_alloc(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return checked_alloc(size, alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return counted_alloc(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return counted_alloc(size, alignment); }
+void operator delete(void* ptr, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { aligned_free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { aligned_free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { aligned_free(ptr); }
+
+TEST_CASE("elib::event_loop: Handlers do not allocate", "[event_loop][allocation]")
+{
+    elib::event_loop<int, 8> loop;
+    loop.set_max_events_per_call(8);
+
+    // a capture bigger than the std::function small buffer of common implementations
+    int sum = 0, count = 0, last = 0;
+    long long weighted = 0;
+
+    const std::size_t before = allocation_num.load();
+
+    loop.set_handler([&sum, &count, &last, &weighted](const int& value) {
+        sum += value;
+        weighted += static_cast<long long>(value) * ++count;
+        last = value;
+    });
+    loop.push(1);
+    loop.push(2);
+    loop.run();
+
+    loop.set_batch_handler([&sum, &count, &last, &weighted](elib::span<const int> values) {
+        for (const int value : values)
+        {
+            sum += value;
+            weighted += static_cast<long long>(value) * ++count;
+            last = value;
+        }
+    });
+    loop.push(3);
+    loop.run();
+
+    const std::size_t allocated = allocation_num.load() - before;
+
+    REQUIRE(allocated == 0);
+    REQUIRE(sum == 6);
+    REQUIRE(count == 3);
+}
+
+TEST_CASE("elib::time::timer: Callbacks do not allocate", "[time][timer][allocation]")
+{
+    int fired = 0, other = 0, more = 0, last = 0;
+
+    const std::size_t before = allocation_num.load();
+
+    auto timer = elib::time::timer::register_timer(std::chrono::milliseconds{1}, [&fired, &other, &more, &last]() {
+        ++fired;
+        other = more = last = fired;
+    });
+    timer.start();
+
+    elib::time::system_clock::increment();
+    elib::time::timer::process_timers();
+
+    timer.set_callback([&fired, &other, &more, &last]() {
+        fired += 10;
+        other = more = last = fired;
+    });
+
+    elib::time::system_clock::increment();
+    elib::time::timer::process_timers();
+
+    const std::size_t allocated = allocation_num.load() - before;
+
+    REQUIRE(allocated == 0);
+    REQUIRE(fired == 11);
+}
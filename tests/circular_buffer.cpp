@@ -1,9 +1,25 @@
 #include <catch2/catch_test_macros.hpp>
 #include <elib/circular_buffer.h>
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <string>
 #include <vector>
 
+// Test Object: move-only, cannot be default constructed, counts live instances
+struct TrackedObject {
+    static inline int alive = 0;
+
+    int id;
+
+    explicit TrackedObject(int i) : id(i) { ++alive; }
+    TrackedObject(TrackedObject&& other) noexcept : id(other.id) { ++alive; }
+    TrackedObject& operator=(TrackedObject&& other) noexcept { id = other.id; return *this; }
+    TrackedObject(const TrackedObject&) = delete;
+    TrackedObject& operator=(const TrackedObject&) = delete;
+    ~TrackedObject() { --alive; }
+};
+
 TEST_CASE("elib::circular_buffer: Default construction", "[circular_buffer]") {
     elib::circular_buffer<int, 4> buf;
 
@@ -120,6 +136,34 @@ TEST_CASE("elib::circular_buffer: Move semantics", "[circular_buffer]") {
     REQUIRE(buf2.back() == 2);
 }
 
+TEST_CASE("elib::circular_buffer: Contiguous front run", "[circular_buffer]") {
+    elib::circular_buffer<int, 4> buf;
+    REQUIRE(buf.array_one().empty());
+
+    buf.push_back(0);
+    buf.push_back(0);
+    buf.push_back(0);
+    buf.erase_begin(3);
+    REQUIRE(buf.empty());
+
+    buf.push_back(1);
+    buf.push_back(2);
+    buf.push_back(3);
+
+    // 1 at the storage end, 2 and 3 wrapped to the storage begin
+    REQUIRE(buf.array_one().size() == 1);
+    REQUIRE(buf.array_one()[0] == 1);
+
+    buf.erase_begin(1);
+    REQUIRE(buf.array_one().size() == 2);
+    REQUIRE(buf.array_one()[1] == 3);
+
+    buf.erase_begin(10);
+    REQUIRE(buf.empty());
+    REQUIRE(buf.push_back(4));
+    REQUIRE(buf.front() == 4);
+}
+
 TEST_CASE("elib::circular_buffer: std::next works", "[circular_buffer]") {
     elib::circular_buffer<int, 5> buf;
     buf.push_back(100);
@@ -362,4 +406,346 @@ TEST_CASE("elib::circular_buffer: linear search", "[circular_buffer]") {
         auto it = std::find(buf.cbegin(), buf.cend(), 5);
         REQUIRE(it != buf.cend());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("elib::circular_buffer: Wrapped run", "[circular_buffer]") {
+    elib::circular_buffer<int, 4> buf;
+    REQUIRE(buf.array_two().empty());
+
+    buf.push_back(0);
+    buf.push_back(0);
+    buf.push_back(1);
+    buf.erase_begin(2);
+    REQUIRE(buf.array_two().empty());
+
+    buf.push_back(2);
+    buf.push_back(3);
+
+    // 1 and 2 at the storage end, 3 wrapped to the storage begin
+    REQUIRE(buf.array_one().size() == 2);
+    REQUIRE(buf.array_two().size() == 1);
+    REQUIRE(buf.array_two()[0] == 3);
+    REQUIRE(buf.array_two().data() + 2 == buf.array_one().data());
+
+    const auto& cbuf = buf;
+    REQUIRE(cbuf.array_two()[0] == 3);
+
+    buf.erase_begin(2);
+    REQUIRE(buf.array_one().size() == 1);
+    REQUIRE(buf.array_two().empty());
+}
+
+TEST_CASE("elib::circular_buffer: Indexing across the wrap", "[circular_buffer]") {
+    // power-of-two capacities wrap with a mask, the others with a compare
+    elib::circular_buffer<int, 4> pow2;
+    elib::circular_buffer<int, 5> other;
+
+    for (int round = 0; round < 12; ++round)
+    {
+        pow2.push_over(round);
+        other.push_over(round);
+
+        for (std::size_t index = 0; index < pow2.size(); ++index)
+        {
+            REQUIRE(pow2[index] == *std::next(pow2.begin(), index));
+            REQUIRE(pow2[index] == round - static_cast<int>(pow2.size() - 1 - index));
+        }
+
+        for (std::size_t index = 0; index < other.size(); ++index)
+            REQUIRE(other[index] == round - static_cast<int>(other.size() - 1 - index));
+
+        REQUIRE(pow2.back() == round);
+        REQUIRE(other.back() == round);
+    }
+
+    other.push_front(100);
+    REQUIRE(other.size() == 5);
+    other.pop_front();
+    other.push_front(100);
+    REQUIRE(other[0] == 100);
+    REQUIRE(other.front() == 100);
+
+    const auto& cpow2 = pow2;
+    REQUIRE(cpow2[3] == 11);
+}
+
+TEST_CASE("elib::circular_buffer: Bulk operations", "[circular_buffer]") {
+    elib::circular_buffer<int, 8> buf;
+    const int values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    // start near the storage end so the bulk copies wrap
+    buf.push_back(0);
+    buf.push_back(0);
+    buf.push_back(0);
+    buf.push_back(0);
+    buf.push_back(0);
+    REQUIRE(buf.discard_front(5) == 5);
+
+    SECTION("Push and pop across the wrap")
+    {
+        REQUIRE(buf.push_back_n(values, 6) == 6);
+        REQUIRE(buf.size() == 6);
+        REQUIRE(buf.front() == 1);
+        REQUIRE(buf.back() == 6);
+        REQUIRE_FALSE(buf.array_two().empty());
+
+        // only the free slots are filled
+        REQUIRE(buf.push_back_n(values + 6, 4) == 2);
+        REQUIRE(buf.full());
+        REQUIRE(buf.back() == 8);
+
+        int out[10]{};
+        REQUIRE(buf.pop_front_n(out, 3) == 3);
+        REQUIRE(out[0] == 1);
+        REQUIRE(out[2] == 3);
+        REQUIRE(buf.front() == 4);
+
+        REQUIRE(buf.pop_front_n(out, 10) == 5);
+        REQUIRE(out[4] == 8);
+        REQUIRE(buf.empty());
+        REQUIRE(buf.pop_front_n(out, 1) == 0);
+    }
+
+    SECTION("Copy out without removing")
+    {
+        REQUIRE(buf.push_back_n(values, 7) == 7);
+
+        int out[7]{};
+        REQUIRE(buf.copy_out(2, out, 4) == 4);
+        REQUIRE(out[0] == 3);
+        REQUIRE(out[3] == 6);
+
+        REQUIRE(buf.copy_out(5, out, 4) == 2);
+        REQUIRE(out[1] == 7);
+
+        REQUIRE(buf.copy_out(7, out, 1) == 0);
+        REQUIRE(buf.size() == 7);
+
+        REQUIRE(buf.discard_front(2) == 2);
+        REQUIRE(buf.front() == 3);
+        REQUIRE(buf.discard_front(10) == 5);
+        REQUIRE(buf.empty());
+    }
+
+    SECTION("Non-trivial elements")
+    {
+        elib::circular_buffer<std::vector<int>, 4> vectors;
+        vectors.push_back(std::vector<int>{});
+        vectors.push_back(std::vector<int>{});
+        vectors.discard_front(2);
+
+        const std::vector<int> items[] = {{1}, {2, 2}, {3, 3, 3}};
+        REQUIRE(vectors.push_back_n(items, 3) == 3);
+        REQUIRE(vectors.back().size() == 3);
+
+        std::vector<int> out[3];
+        REQUIRE(vectors.copy_out(0, out, 3) == 3);
+        REQUIRE(out[1].size() == 2);
+
+        REQUIRE(vectors.pop_front_n(out, 3) == 3);
+        REQUIRE(out[2].size() == 3);
+        REQUIRE(vectors.empty());
+    }
+}
+
+TEST_CASE("elib::circular_buffer: In-place reservation", "[circular_buffer]") {
+    elib::circular_buffer<std::uint8_t, 8> buf;
+
+    SECTION("Producer writes into the free run")
+    {
+        auto reserved = buf.write_reserve();
+        REQUIRE(reserved.size() == 8);
+
+        reserved[0] = 1;
+        reserved[1] = 2;
+        reserved[2] = 3;
+        REQUIRE(buf.write_commit(3) == 3);
+        REQUIRE(buf.size() == 3);
+        REQUIRE(buf.back() == 3);
+
+        REQUIRE(buf.write_reserve().size() == 5);
+        REQUIRE(buf.write_reserve().data() == reserved.data() + 3);
+    }
+
+    SECTION("Free space that wraps is reserved one run at a time")
+    {
+        const std::uint8_t values[] = {0, 0, 0, 0, 0, 0};
+        buf.push_back_n(values, 6);
+        buf.discard_front(4);
+
+        // slots 6, 7 free at the storage end, 0..3 at the storage begin
+        auto reserved = buf.write_reserve();
+        REQUIRE(reserved.size() == 2);
+        reserved[0] = 7;
+        reserved[1] = 8;
+        REQUIRE(buf.write_commit(2) == 2);
+
+        reserved = buf.write_reserve();
+        REQUIRE(reserved.size() == 4);
+        reserved[0] = 9;
+        REQUIRE(buf.write_commit(10) == 4); // clamped to the free space
+        REQUIRE(buf.full());
+        REQUIRE(buf.write_reserve().empty());
+
+        REQUIRE(buf[2] == 7);
+        REQUIRE(buf[4] == 9);
+    }
+
+    SECTION("A drained ring reserves its whole capacity")
+    {
+        const std::uint8_t values[] = {1, 2, 3, 4, 5, 6};
+        buf.push_back_n(values, 6);
+        buf.discard_front(6);
+        buf.push_back_n(values, 5); // wraps: slots 6, 7, 0, 1, 2
+
+        REQUIRE(buf.read_release(buf.read_acquire().size()) == 2);
+        REQUIRE(buf.read_release(buf.read_acquire().size()) == 3);
+        REQUIRE(buf.empty());
+
+        auto reserved = buf.write_reserve();
+        REQUIRE(reserved.size() == buf.capacity());
+        reserved[0] = 7;
+        REQUIRE(buf.write_commit(1) == 1);
+        REQUIRE(buf.front() == 7);
+    }
+
+    SECTION("Consumer reads the front run in place")
+    {
+        REQUIRE(buf.read_acquire().empty());
+
+        const std::uint8_t values[] = {1, 2, 3, 4, 5, 6, 7};
+        buf.push_back_n(values, 5);
+        buf.discard_front(5);
+        buf.push_back_n(values, 7);
+
+        auto acquired = buf.read_acquire();
+        REQUIRE(acquired.size() == 3);
+        REQUIRE(acquired[0] == 1);
+        REQUIRE(buf.read_release(acquired.size()) == 3);
+
+        acquired = buf.read_acquire();
+        REQUIRE(acquired.size() == 4);
+        REQUIRE(acquired[0] == 4);
+        REQUIRE(buf.read_release(10) == 4);
+        REQUIRE(buf.empty());
+    }
+}
+
+TEST_CASE("elib::circular_buffer: Element lifetime", "[circular_buffer]") {
+    TrackedObject::alive = 0;
+
+    SECTION("Elements live from push to pop")
+    {
+        elib::circular_buffer<TrackedObject, 4> buf;
+        REQUIRE(TrackedObject::alive == 0); // no slot is constructed up front
+
+        REQUIRE(buf.emplace_back(1));
+        REQUIRE(buf.push_back(TrackedObject{2}));
+        REQUIRE(buf.push_front(TrackedObject{0}));
+        REQUIRE(TrackedObject::alive == 3);
+        REQUIRE(buf.front().id == 0);
+        REQUIRE(buf.back().id == 2);
+
+        REQUIRE(buf.pop_front());
+        REQUIRE(buf.pop_back());
+        REQUIRE(TrackedObject::alive == 1);
+
+        // wrap the content
+        buf.emplace_back(2);
+        buf.emplace_back(3);
+        buf.emplace_back(4);
+        REQUIRE(buf.full());
+        REQUIRE_FALSE(buf.emplace_back(5));
+        REQUIRE(TrackedObject::alive == 4);
+
+        buf.push_over(TrackedObject{5});
+        REQUIRE(TrackedObject::alive == 4);
+        REQUIRE(buf.front().id == 2);
+
+        REQUIRE(buf.discard_front(2) == 2);
+        REQUIRE(TrackedObject::alive == 2);
+
+        buf.clear();
+        REQUIRE(TrackedObject::alive == 0);
+
+        buf.emplace_back(6);
+        buf.emplace_back(7);
+    }
+    REQUIRE(TrackedObject::alive == 0); // destructor destroys the rest
+
+    SECTION("Insert and erase across the wrap")
+    {
+        elib::circular_buffer<TrackedObject, 5> buf;
+        buf.emplace_back(0);
+        buf.emplace_back(0);
+        buf.discard_front(2);
+        buf.emplace_back(1);
+        buf.emplace_back(3);
+        buf.emplace_back(4);
+
+        buf.insert(std::next(buf.cbegin(), 1), TrackedObject{2}); // closer to the front
+        buf.insert(buf.cbegin(), TrackedObject{0});
+        REQUIRE(buf.full());
+        REQUIRE(TrackedObject::alive == 5);
+
+        std::vector<int> ids;
+        for (const auto& object : buf)
+            ids.push_back(object.id);
+        REQUIRE(ids == std::vector<int>{0, 1, 2, 3, 4});
+
+        buf.erase(std::next(buf.cbegin(), 3));
+        buf.erase(std::next(buf.cbegin(), 1));
+        REQUIRE(TrackedObject::alive == 3);
+
+        buf.insert(std::next(buf.cbegin(), 2), TrackedObject{5}); // closer to the back
+        buf.insert(buf.cend(), TrackedObject{6});
+        REQUIRE(TrackedObject::alive == 5);
+
+        ids.clear();
+        for (const auto& object : buf)
+            ids.push_back(object.id);
+        REQUIRE(ids == std::vector<int>{0, 2, 5, 4, 6});
+    }
+    REQUIRE(TrackedObject::alive == 0);
+
+    SECTION("Move leaves the source empty")
+    {
+        elib::circular_buffer<TrackedObject, 4> buf;
+        buf.emplace_back(0);
+        buf.emplace_back(0);
+        buf.discard_front(2);
+        buf.emplace_back(1);
+        buf.emplace_back(2);
+        buf.emplace_back(3);
+
+        elib::circular_buffer<TrackedObject, 4> moved = std::move(buf);
+        REQUIRE(buf.empty());
+        REQUIRE(moved.size() == 3);
+        REQUIRE(moved.front().id == 1);
+        REQUIRE(moved.back().id == 3);
+        REQUIRE(TrackedObject::alive == 3);
+
+        TrackedObject out[3]{TrackedObject{0}, TrackedObject{0}, TrackedObject{0}};
+        REQUIRE(moved.pop_front_n(out, 3) == 3);
+        REQUIRE(out[2].id == 3);
+        REQUIRE(TrackedObject::alive == 3);
+    }
+    REQUIRE(TrackedObject::alive == 0);
+}
+
+TEST_CASE("elib::circular_buffer: Copy of non-trivial elements", "[circular_buffer]") {
+    elib::circular_buffer<std::string, 3> buf{"a", "b"};
+    buf.pop_front();
+    buf.push_back("c");
+    buf.push_back("d"); // wrapped: [b, c, d]
+
+    elib::circular_buffer<std::string, 3> copy{"x"};
+    copy = buf;
+    REQUIRE(copy.size() == 3);
+    REQUIRE(copy[0] == "b");
+    REQUIRE(copy[2] == "d");
+    REQUIRE(buf.size() == 3);
+
+    const elib::circular_buffer<std::string, 3> constructed{buf};
+    REQUIRE(constructed.back() == "d");
+}
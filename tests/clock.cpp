@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+
+#include <elib/time/deadline_timer.h>
+#include <elib/time/elapsed_timer.h>
+#include <elib/time/epoch_clock.h>
+#include <elib/time/system_clock.h>
+#include <elib/time/tick_math.h>
+
+using namespace elib;
+
+namespace
+{
+    using rep = time::system_clock::rep;
+    constexpr rep rep_max = std::numeric_limits<rep>::max();
+    constexpr std::uint64_t wrap = std::uint64_t{rep_max} + 1;
+}
+
+TEST_CASE("elib::time: Tick arithmetic is wrap-safe", "[time]")
+{
+    REQUIRE(time::ticks_between<std::uint32_t>(0xFFFFFFF0u, 0x10u) == 0x20u);
+    REQUIRE(time::tick_before<std::uint32_t>(0xFFFFFFF0u, 0x10u));
+    REQUIRE_FALSE(time::tick_before<std::uint32_t>(0x10u, 0xFFFFFFF0u));
+    REQUIRE_FALSE(time::tick_before<std::uint32_t>(5u, 5u));
+
+    REQUIRE(time::ticks_between<std::uint16_t>(0xFFFF, 0x0002) == 3);
+    REQUIRE(time::tick_before<std::uint16_t>(0xFFFF, 0x0002));
+}
+
+TEST_CASE("elib::time::epoch_clock: Extends the system clock past its wraparound", "[time]")
+{
+    time::system_clock::reset();
+    REQUIRE(time::epoch_clock::ticks() == 0);
+
+    SECTION("Tick by tick")
+    {
+        time::system_clock::set(rep_max - 2);
+
+        std::uint64_t previous = time::epoch_clock::ticks();
+        for (int tick = 0; tick < 5; ++tick)
+        {
+            time::system_clock::increment();
+
+            const std::uint64_t now = time::epoch_clock::ticks();
+            REQUIRE(now == previous + 1);
+            previous = now;
+        }
+
+        REQUIRE(time::system_clock::ticks() == 2);
+        REQUIRE(previous == wrap + 2);
+    }
+
+    SECTION("Across several wraps")
+    {
+        // bulk jumps, each less than one counter range
+        for (int step = 0; step < 7; ++step)
+            time::system_clock::advance(rep_max / 2 + 1);
+
+        REQUIRE(time::epoch_clock::ticks() == 7 * (std::uint64_t{rep_max} / 2 + 1));
+        REQUIRE(time::epoch_clock::ticks() > 3 * wrap);
+        REQUIRE(time::system_clock::ticks() == static_cast<rep>(time::epoch_clock::ticks()));
+    }
+
+    SECTION("Setting the system clock restarts the epoch")
+    {
+        time::system_clock::advance(rep_max);
+        time::system_clock::advance(rep_max);
+        time::system_clock::set(100);
+        REQUIRE(time::epoch_clock::ticks() == 100);
+    }
+
+    time::system_clock::reset();
+}
+
+TEST_CASE("elib::time::deadline_timer: Deadline across the clock wraparound", "[time]")
+{
+    using clock = time::system_clock;
+
+    clock::set(rep_max - 4);
+    time::deadline_timer<clock> deadline{clock::duration{10}};
+
+    REQUIRE_FALSE(deadline.hasExpired());
+    REQUIRE(deadline.remainingTime() == clock::duration{10});
+
+    clock::set(3); // wrapped, 2 ticks left
+    REQUIRE_FALSE(deadline.hasExpired());
+    REQUIRE(deadline.remainingTime() == clock::duration{2});
+
+    clock::set(5);
+    REQUIRE(deadline.hasExpired());
+    REQUIRE(deadline.remainingTime() == clock::duration::zero());
+
+    clock::set(1000);
+    REQUIRE(deadline.hasExpired());
+    REQUIRE(deadline.remainingTime() == clock::duration::zero());
+
+    clock::reset();
+}
+
+TEST_CASE("elib::time::elapsed_timer: Elapsed time across the clock wraparound", "[time]")
+{
+    using clock = time::system_clock;
+
+    clock::set(rep_max - 4);
+    time::elapsed_timer<clock> elapsed;
+    elapsed.start();
+
+    clock::set(5);
+    REQUIRE(elapsed.elapsed() == clock::duration{10});
+    REQUIRE(elapsed.elapsed(clock::duration{10}));
+    REQUIRE_FALSE(elapsed.elapsed(clock::duration{11}));
+
+    REQUIRE(clock::has_passed(clock::duration_from{clock::time_point{clock::duration{rep_max - 4}}, clock::duration{10}}));
+    REQUIRE_FALSE(clock::has_passed(clock::time_point{clock::duration{rep_max - 4}}, 11));
+
+    clock::reset();
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/co_task.h>
+#include <elib/event_loop.h>
+#include <elib/kernel.h>
+#include <elib/time/system_clock.h>
+#include <elib/time/timer.h>
+#include <vector>
+
+#if ELIB_HAS_COROUTINES
+
+namespace
+{
+    elib::co_task count_slices(int& step)
+    {
+        step = 1;
+        co_await elib::yield();
+        step = 2;
+        co_await elib::yield();
+        step = 3;
+    }
+
+    elib::co_task sleeper(int& step)
+    {
+        step = 1;
+        co_await elib::time::sleep_for(std::chrono::milliseconds{10});
+        step = 2;
+        co_await elib::time::sleep_for(std::chrono::milliseconds{0});
+        step = 3;
+    }
+
+    elib::co_task consumer(elib::event_loop<int, 4>& loop, std::vector<int>& received)
+    {
+        for (;;)
+            received.push_back(co_await loop.next_event());
+    }
+
+    elib::co_task idle()
+    {
+        co_await elib::yield();
+    }
+}
+
+TEST_CASE("elib::co_task: Kernel resumes the coroutine one step per slice", "[co_task]")
+{
+    int step = 0;
+    elib::co_task task = count_slices(step);
+
+    REQUIRE(task.valid());
+    REQUIRE(step == 0); // lazily started
+
+    REQUIRE(elib::kernel::process_tasks());
+    REQUIRE(step == 1);
+    REQUIRE(elib::kernel::process_tasks());
+    REQUIRE(step == 2);
+    REQUIRE(elib::kernel::process_tasks());
+    REQUIRE(step == 3);
+    REQUIRE(task.done());
+
+    // a finished coroutine leaves the ready set
+    REQUIRE_FALSE(elib::kernel::process_tasks());
+}
+
+TEST_CASE("elib::co_task: sleep_for parks until the deadline", "[co_task]")
+{
+    elib::time::system_clock::reset();
+
+    int step = 0;
+    elib::co_task task = sleeper(step);
+
+    REQUIRE(elib::kernel::process_all());
+    REQUIRE(step == 1);
+
+    // parked: the kernel has nothing to run until the timer fires
+    elib::time::system_clock::set(9);
+    REQUIRE_FALSE(elib::kernel::process_all());
+    REQUIRE(step == 1);
+
+    elib::time::system_clock::set(10);
+    REQUIRE(elib::kernel::process_all());
+
+    // an elapsed deadline does not suspend
+    REQUIRE(step == 3);
+    REQUIRE(task.done());
+    REQUIRE(elib::time::timer::next_expiry() == elib::time::system_clock::duration::max());
+}
+
+TEST_CASE("elib::co_task: next_event parks until an event is pushed", "[co_task][event_loop]")
+{
+    elib::event_loop<int, 4> loop;
+    int handled = 0;
+    loop.set_handler([&handled](const int&) { handled++; });
+
+    std::vector<int> received;
+    elib::co_task task = consumer(loop, received);
+
+    REQUIRE(elib::kernel::process_all()); // loop suspends itself
+    REQUIRE(elib::kernel::process_all()); // coroutine parks
+    REQUIRE_FALSE(elib::kernel::process_all());
+
+    SECTION("A push wakes the coroutine, not the loop")
+    {
+        loop.push(1);
+        REQUIRE(elib::kernel::process_all());
+        REQUIRE(received == std::vector<int>{1});
+        REQUIRE_FALSE(elib::kernel::process_all());
+
+        // both events in one slice: the second await does not suspend
+        loop.push(2);
+        loop.push(3);
+        REQUIRE(elib::kernel::process_all());
+        REQUIRE_FALSE(elib::kernel::process_all());
+        REQUIRE(received == std::vector<int>{1, 2, 3});
+        REQUIRE(handled == 0);
+    }
+
+    SECTION("Destroying the coroutine releases the loop")
+    {
+        task = elib::co_task{};
+
+        loop.push(1);
+        elib::kernel::process_all();
+
+        // still consumed by a coroutine: the event is kept for the next one
+        REQUIRE(handled == 0);
+        REQUIRE(loop.size() == 1);
+
+        task = consumer(loop, received);
+        elib::kernel::process_all();
+        REQUIRE(received == std::vector<int>{1});
+    }
+}
+
+TEST_CASE("elib::co_task: Frames come from the static pool", "[co_task]")
+{
+    const std::size_t available = elib::co_task::frames_available();
+    REQUIRE(available == elib::kernel::config::coroutine_frame_num);
+
+    std::vector<elib::co_task> tasks;
+    for (std::size_t count = 0; count < available; ++count)
+    {
+        tasks.push_back(idle());
+        REQUIRE(tasks.back().valid());
+    }
+
+    REQUIRE(elib::co_task::frames_available() == 0);
+
+    // pool exhausted: no heap fallback
+    REQUIRE_FALSE(idle().valid());
+
+    tasks.pop_back();
+    REQUIRE(elib::co_task::frames_available() == 1);
+    REQUIRE(idle().valid());
+}
+
+#endif
@@ -273,4 +273,60 @@ TEST_CASE("elib::event_loop push over capacity - force push", "[event_loop]")
 
   REQUIRE(processed[0] == 2); // 1 was overwritten, 2 become first processed
   REQUIRE(processed[1] == 3); // 3 was forced and processed
-}
\ No newline at end of file
+}
+
+TEST_CASE("elib::event_loop batch handler", "[event_loop]")
+{
+  elib::event_loop<int, 4> loop;
+
+  std::vector<std::vector<int>> blocks;
+  loop.set_batch_handler([&](elib::span<const int> events) {
+    blocks.emplace_back(events.begin(), events.end());
+  });
+
+  SECTION("Contiguous events arrive as one block")
+  {
+    loop.push(1);
+    loop.push(2);
+    loop.push(3);
+    loop.run();
+
+    REQUIRE(blocks.size() == 1);
+    REQUIRE(blocks[0] == std::vector<int>{1, 2, 3});
+    REQUIRE(loop.empty());
+  }
+
+  SECTION("Wrapped queue arrives as two blocks")
+  {
+    loop.push(0);
+    loop.push(0);
+    loop.push(0);
+    loop.run();
+    blocks.clear();
+
+    // 1 at the storage end, 2 and 3 at the storage begin
+    loop.push(1);
+    loop.push(2);
+    loop.push(3);
+    loop.run();
+
+    REQUIRE(blocks.size() == 2);
+    REQUIRE(blocks[0] == std::vector<int>{1});
+    REQUIRE(blocks[1] == std::vector<int>{2, 3});
+    REQUIRE(loop.empty());
+  }
+
+  SECTION("Reset restores per-event dispatch")
+  {
+    int call_count = 0;
+    loop.set_handler([&](const int&) { call_count++; });
+    loop.set_batch_handler(nullptr);
+
+    loop.push(1);
+    loop.push(2);
+    loop.run();
+
+    REQUIRE(blocks.empty());
+    REQUIRE(call_count == 1);
+  }
+}
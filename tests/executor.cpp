@@ -0,0 +1,147 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/host/executor.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace
+{
+    // counts slices and detects a slice overlapping with another slice of the same task
+    class probe_task : public elib::kernel::task_base
+    {
+    public:
+        std::atomic<int> run_count{0};
+        std::atomic<bool> overlapped{false};
+
+        void run() override
+        {
+            if (in_flight_.fetch_add(1) != 0)
+                overlapped = true;
+
+            {
+                std::lock_guard<std::mutex> lock{threads_mutex_};
+                threads_.insert(std::this_thread::get_id());
+            }
+
+            std::this_thread::yield();
+            run_count++;
+
+            in_flight_.fetch_sub(1);
+        }
+
+        std::size_t thread_num()
+        {
+            std::lock_guard<std::mutex> lock{threads_mutex_};
+            return threads_.size();
+        }
+
+    private:
+        std::atomic<int> in_flight_{0};
+        std::mutex threads_mutex_;
+        std::set<std::thread::id> threads_;
+    };
+
+    template<typename Predicate>
+    bool wait_for(Predicate predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE("elib::host::executor: Runs every task, never concurrently with itself", "[executor]")
+{
+    std::array<probe_task, 16> tasks;
+    elib::host::executor executor{4};
+    REQUIRE(executor.worker_num() == 4);
+
+    for (auto& task : tasks)
+        executor.add(task);
+    executor.add(tasks[0]); // duplicates are ignored
+
+    executor.start();
+    REQUIRE(wait_for([&] {
+        return std::all_of(tasks.begin(), tasks.end(), [](const probe_task& task) { return task.run_count >= 200; });
+    }));
+    executor.stop();
+
+    for (auto& task : tasks)
+        REQUIRE_FALSE(task.overlapped);
+}
+
+TEST_CASE("elib::host::executor: Idle workers steal", "[executor]")
+{
+    std::array<probe_task, 8> tasks;
+    elib::host::executor executor{4};
+
+    // tasks are placed round-robin, leave work on worker 0 only
+    for (auto& task : tasks)
+        executor.add(task);
+    for (std::size_t index = 0; index < tasks.size(); ++index)
+    {
+        if (index % 4)
+            executor.remove(tasks[index]);
+    }
+
+    executor.start();
+    REQUIRE(wait_for([&] { return executor.steal_count() > 0; }));
+    executor.stop();
+}
+
+TEST_CASE("elib::host::executor: Pinned task stays on its worker", "[executor]")
+{
+    std::array<probe_task, 8> tasks;
+    probe_task pinned;
+    elib::host::executor executor{4};
+
+    // leave the pinned task and two stealable ones on worker 2, the others idle
+    executor.add(pinned, 2);
+    for (auto& task : tasks)
+        executor.add(task);
+    for (std::size_t index = 0; index < tasks.size(); ++index)
+    {
+        if (index % 4 != 2)
+            executor.remove(tasks[index]);
+    }
+
+    executor.start();
+    REQUIRE(wait_for([&] { return pinned.run_count >= 500 && executor.steal_count() > 0; }));
+    executor.stop();
+
+    REQUIRE(pinned.thread_num() == 1);
+    REQUIRE_FALSE(pinned.overlapped);
+}
+
+TEST_CASE("elib::host::executor: Removed task does not run again", "[executor]")
+{
+    std::array<probe_task, 8> tasks;
+    elib::host::executor executor{3};
+
+    for (auto& task : tasks)
+        executor.add(task);
+
+    executor.start();
+    REQUIRE(wait_for([&] { return tasks[3].run_count >= 50; }));
+
+    executor.remove(tasks[3]);
+    const int count = tasks[3].run_count;
+
+    REQUIRE(wait_for([&] { return tasks[4].run_count >= count + 100; }));
+    REQUIRE(tasks[3].run_count == count);
+
+    // can be added back
+    executor.add(tasks[3]);
+    REQUIRE(wait_for([&] { return tasks[3].run_count > count; }));
+    executor.stop();
+}
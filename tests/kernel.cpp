@@ -4,6 +4,8 @@
 #include <elib/task.h>
 #include <elib/event_loop.h>
 #include <elib/config.h>
+#include <elib/time/system_clock.h>
+#include <elib/time/timer.h>
 #include <vector>
 #include <memory>
 
@@ -144,6 +146,49 @@ TEST_CASE("elib::kernel: Registry Capacity Limits", "[kernel]")
     elib::kernel::process_tasks(); // Should be safe
 }
 
+TEST_CASE("elib::kernel: Registry Slot Reuse", "[kernel]")
+{
+    const std::size_t limit = elib::kernel::task_max_num();
+
+    class counting_task : public elib::manual_task
+    {
+    public:
+        int run_count = 0;
+        void run() override { run_count++; }
+    };
+
+    std::vector<counting_task> pool(limit);
+
+    // churn: start everything, stop every other task, start them again in reverse order
+    for (auto& task : pool)
+        task.start();
+
+    for (std::size_t index = 0; index < limit; index += 2)
+        pool[index].stop();
+
+    for (std::size_t index = limit; index-- > 0;)
+    {
+        if (index % 2 == 0)
+            pool[index].start();
+    }
+
+    // the registry is full again: every freed slot was reused
+    class bare_task : public elib::kernel::task_base
+    {
+    public:
+        void run() override {}
+    };
+
+    bare_task extra;
+    REQUIRE_FALSE(elib::kernel::register_task(extra));
+
+    for (std::size_t round = 0; round < limit; ++round)
+        elib::kernel::process_tasks();
+
+    for (const auto& task : pool)
+        REQUIRE(task.run_count == 1);
+}
+
 TEST_CASE("elib::ManualTask Lifecycle", "[task]")
 {
     class my_manual_task : public elib::manual_task
@@ -238,4 +283,122 @@ TEST_CASE("elib::GenericTask Adapter", "[task]")
         elib::kernel::process_all();
         REQUIRE(module.counter == 1);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("elib::kernel: Ready Set", "[kernel]")
+{
+    // polls once, then sleeps until notified
+    class sleepy_task : public elib::task
+    {
+    public:
+        int run_count = 0;
+        void run() override
+        {
+            run_count++;
+            elib::kernel::suspend(*this);
+        }
+    };
+
+    SECTION("Suspended task is not dispatched until notified")
+    {
+        sleepy_task task;
+
+        REQUIRE(elib::kernel::process_tasks());
+        REQUIRE(task.run_count == 1);
+
+        REQUIRE_FALSE(elib::kernel::process_tasks());
+        REQUIRE_FALSE(elib::kernel::process_all());
+        REQUIRE(task.run_count == 1);
+
+        elib::kernel::notify(task);
+        REQUIRE(elib::kernel::process_tasks());
+        REQUIRE(task.run_count == 2);
+    }
+
+    SECTION("Notification during run is not lost")
+    {
+        class self_notifying_task : public elib::task
+        {
+        public:
+            int run_count = 0;
+            void run() override
+            {
+                run_count++;
+                elib::kernel::notify(*this); // e.g. an ISR firing mid-slice
+                elib::kernel::suspend(*this);
+            }
+        };
+
+        self_notifying_task task;
+
+        elib::kernel::process_tasks();
+        elib::kernel::process_tasks();
+        REQUIRE(task.run_count == 2);
+    }
+
+    SECTION("Idle event loops cost nothing")
+    {
+        elib::event_loop<int, 4> loop;
+        int handled = 0;
+        loop.set_handler([&](int) { handled++; });
+
+        // first slice finds the queue empty and suspends the loop
+        elib::kernel::process_all();
+        REQUIRE_FALSE(elib::kernel::process_all());
+
+        loop.push(1);
+        REQUIRE(elib::kernel::process_all());
+        REQUIRE(handled == 1);
+        REQUIRE_FALSE(elib::kernel::process_all());
+    }
+
+    SECTION("Timer expiry wakes the owning task")
+    {
+        sleepy_task task;
+        elib::kernel::process_tasks();
+
+        elib::time::system_clock::reset();
+        auto timer = elib::time::timer::register_timer(std::chrono::milliseconds{10}, task);
+        timer.start();
+
+        elib::time::system_clock::set(9);
+        REQUIRE_FALSE(elib::kernel::process_all());
+
+        elib::time::system_clock::set(10);
+        REQUIRE(elib::kernel::process_all());
+        REQUIRE(task.run_count == 2);
+    }
+}
+
+TEST_CASE("elib::kernel: Idle Hint", "[kernel]")
+{
+    class sleepy_task : public elib::task
+    {
+    public:
+        void run() override { elib::kernel::suspend(*this); }
+    };
+
+    sleepy_task task;
+    elib::kernel::process_tasks();
+
+    auto hint = elib::kernel::idle_hint();
+    REQUIRE_FALSE(hint.work_pending);
+    REQUIRE(hint.sleep_for == elib::time::system_clock::duration::max());
+
+    elib::time::system_clock::reset();
+    auto timer = elib::time::timer::register_timer(std::chrono::milliseconds{100}, task);
+    timer.start();
+
+    hint = elib::kernel::idle_hint();
+    REQUIRE_FALSE(hint.work_pending);
+    REQUIRE(hint.sleep_for == elib::time::system_clock::duration{100});
+
+    elib::kernel::notify(task);
+    REQUIRE(elib::kernel::idle_hint().work_pending);
+    elib::kernel::process_tasks();
+    REQUIRE_FALSE(elib::kernel::idle_hint().work_pending);
+
+    // sleep until the deadline, then catch up: the timer wakes the task
+    elib::time::timer::advance_clock(hint.sleep_for);
+    REQUIRE(elib::kernel::idle_hint().work_pending);
+}
@@ -0,0 +1,172 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/kernel.h>
+#include <elib/task.h>
+#include <elib/config.h>
+#include <elib/time/system_clock.h>
+
+// Built against a kernel with the priority bands and task statistics enabled,
+// see kernel_config/elib.tweaks.h
+
+class test_task : public elib::task
+{
+public:
+    int run_count = 0;
+
+    void run() override {
+        run_count++;
+    }
+};
+
+TEST_CASE("elib::kernel: Priority Bands", "[kernel]")
+{
+    class priority_task : public elib::task
+    {
+    public:
+        explicit priority_task(elib::kernel::priority_type priority)
+            : elib::task(priority)
+        {
+        }
+
+        int run_count = 0;
+        void run() override { run_count++; }
+    };
+
+    SECTION("Higher band always runs first")
+    {
+        test_task background;
+        priority_task urgent{2};
+
+        for (int i = 0; i < 10; ++i)
+            elib::kernel::process_tasks();
+
+        REQUIRE(urgent.run_count == 10);
+        REQUIRE(background.run_count == 0);
+    }
+
+    SECTION("Round-robin inside a band")
+    {
+        priority_task first{1};
+        priority_task second{1};
+        test_task background;
+
+        for (int i = 0; i < 10; ++i)
+            elib::kernel::process_tasks();
+
+        REQUIRE(first.run_count == 5);
+        REQUIRE(second.run_count == 5);
+        REQUIRE(background.run_count == 0);
+    }
+
+    SECTION("Lower band resumes once higher band is empty")
+    {
+        test_task background;
+        {
+            priority_task urgent{3};
+            elib::kernel::process_tasks();
+            REQUIRE(urgent.run_count == 1);
+        }
+
+        elib::kernel::process_tasks();
+        REQUIRE(background.run_count == 1);
+    }
+
+    SECTION("Priority above the last band is clamped")
+    {
+        priority_task highest{3};
+        priority_task clamped{200};
+
+        elib::kernel::process_tasks();
+        elib::kernel::process_tasks();
+
+        REQUIRE(highest.run_count == 1);
+        REQUIRE(clamped.run_count == 1);
+    }
+
+    SECTION("Manual task starts in its own band")
+    {
+        class urgent_manual_task : public elib::manual_task
+        {
+        public:
+            urgent_manual_task() : elib::manual_task(2) {}
+
+            int run_count = 0;
+            void run() override
+            {
+                run_count++;
+                stop(); // one-shot urgent work
+            }
+        };
+
+        test_task background;
+        urgent_manual_task urgent;
+
+        elib::kernel::process_tasks();
+        REQUIRE(background.run_count == 1);
+
+        urgent.start();
+        elib::kernel::process_tasks();
+        REQUIRE(urgent.run_count == 1);
+
+        elib::kernel::process_tasks();
+        REQUIRE(urgent.run_count == 1);
+        REQUIRE(background.run_count == 2);
+    }
+}
+
+TEST_CASE("elib::kernel: Task Statistics", "[kernel]")
+{
+    // every slice "takes" `cost` system clock ticks
+    class busy_task : public elib::task
+    {
+    public:
+        elib::time::system_clock::rep cost = 1;
+
+        void run() override { elib::time::system_clock::advance(cost); }
+    };
+
+    const auto stats_of = [](const elib::kernel::task_base& task) {
+        elib::kernel::task_stats found{};
+        elib::kernel::visit_stats([&](const elib::kernel::task_base& visited, const elib::kernel::task_stats& stats) {
+            if (&visited == &task)
+                found = stats;
+        });
+        return found;
+    };
+
+    elib::time::system_clock::reset();
+    busy_task task;
+
+    REQUIRE(stats_of(task).run_count == 0);
+
+    elib::kernel::process_tasks();
+    task.cost = elib::kernel::config::task_slice_budget + 1; // overrun
+    elib::kernel::process_tasks();
+    task.cost = 2;
+    elib::kernel::process_tasks();
+
+    auto stats = stats_of(task);
+    REQUIRE(stats.run_count == 3);
+    REQUIRE(stats.total_ticks == 1 + elib::kernel::config::task_slice_budget + 1 + 2);
+    REQUIRE(stats.max_ticks == elib::kernel::config::task_slice_budget + 1);
+    REQUIRE(stats.overruns == 1);
+
+    elib::kernel::reset_stats();
+    REQUIRE(stats_of(task).run_count == 0);
+
+    SECTION("Statistics follow a moved task")
+    {
+        elib::kernel::process_tasks();
+
+        busy_task moved{std::move(task)};
+        REQUIRE(stats_of(moved).run_count == 1);
+    }
+
+    SECTION("Re-registration starts from scratch")
+    {
+        elib::kernel::process_tasks();
+        elib::kernel::unregister_task(task);
+        elib::kernel::register_task(task);
+
+        REQUIRE(stats_of(task).run_count == 0);
+    }
+}
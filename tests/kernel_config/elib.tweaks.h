@@ -0,0 +1,12 @@
+#define ELIB_USER_ERROR_HANDLER // override assert/error handler for tests
+
+#include <cstddef>
+#include <cstdint>
+
+// kernel build of elib.test.kernel_config, the main suite keeps the defaults
+namespace elib::kernel::config
+{
+  inline constexpr std::size_t priority_levels = 4; // exercise priority bands
+  inline constexpr bool task_stats = true;          // exercise task statistics (system clock ticks)
+  inline constexpr std::uint32_t task_slice_budget = 5;
+}
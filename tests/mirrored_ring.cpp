@@ -0,0 +1,96 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/host/mirrored_ring.h>
+#include <elib/stream.h>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+TEST_CASE("elib::host::mirrored_ring: Mirrored storage", "[mirrored_ring]") {
+    elib::host::mirrored_ring<4096> ring;
+    REQUIRE(ring.valid());
+    REQUIRE(ring.empty());
+    REQUIRE(ring.capacity() == 4096);
+    REQUIRE(ring.write_reserve().size() == 4096);
+
+    // move the front close to the storage end
+    std::array<std::uint8_t, 4090> filler{};
+    REQUIRE(ring.push_back_n(filler.data(), filler.size()) == filler.size());
+    REQUIRE(ring.discard_front(filler.size()) == filler.size());
+
+    SECTION("Regions across the storage end are contiguous")
+    {
+        // all free space is one run although it wraps
+        auto reserved = ring.write_reserve();
+        REQUIRE(reserved.size() == 4096);
+
+        elib::data::output_stream out{reserved.data(), reserved.size()};
+        REQUIRE(out.write_all(std::uint32_t{0x11223344}, std::uint32_t{0x55667788}));
+        REQUIRE(ring.write_commit(out.pos()) == 8);
+
+        REQUIRE(ring.size() == 8);
+        REQUIRE(ring.array_two().empty());
+
+        auto bytes = ring.read_acquire();
+        REQUIRE(bytes.size() == 8);
+
+        std::uint32_t first{};
+        std::uint32_t second{};
+        elib::data::input_stream in{bytes.data(), bytes.size()};
+        REQUIRE(in.read_all(first, second));
+        REQUIRE(first == 0x11223344);
+        REQUIRE(second == 0x55667788);
+
+        REQUIRE(ring.read_release(in.pos()) == 8);
+        REQUIRE(ring.empty());
+    }
+
+    SECTION("Element access and bulk copies")
+    {
+        const std::uint8_t values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        REQUIRE(ring.push_back_n(values, 10) == 10);
+        REQUIRE(ring.push_back(11));
+
+        REQUIRE(ring.front() == 1);
+        REQUIRE(ring.back() == 11);
+        REQUIRE(ring[7] == 8);
+
+        std::uint8_t out[10]{};
+        REQUIRE(ring.copy_out(4, out, 10) == 7);
+        REQUIRE(out[0] == 5);
+        REQUIRE(out[6] == 11);
+
+        REQUIRE(ring.pop_front_n(out, 3) == 3);
+        REQUIRE(out[2] == 3);
+        REQUIRE(ring.pop_front());
+        REQUIRE(ring.front() == 5);
+        REQUIRE(ring.size() == 7);
+
+        ring.clear();
+        REQUIRE(ring.empty());
+    }
+
+    SECTION("Full ring")
+    {
+        std::array<std::uint8_t, 4096> bytes{};
+        bytes.back() = 42;
+
+        REQUIRE(ring.push_back_n(bytes.data(), bytes.size()) == 4096);
+        REQUIRE(ring.full());
+        REQUIRE(ring.back() == 42);
+        REQUIRE(ring.write_reserve().empty());
+        REQUIRE_FALSE(ring.push_back(0));
+        REQUIRE(ring.write_commit(1) == 0);
+    }
+
+    SECTION("Move")
+    {
+        REQUIRE(ring.push_back(7));
+
+        elib::host::mirrored_ring<4096> moved{std::move(ring)};
+        REQUIRE(moved.valid());
+        REQUIRE(moved.front() == 7);
+        REQUIRE_FALSE(ring.valid());
+        REQUIRE(ring.full());
+    }
+}
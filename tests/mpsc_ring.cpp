@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/mpsc_ring.h>
+#include <elib/event_loop.h>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST_CASE("elib::mpsc_ring: Push and pop elements", "[mpsc_ring]")
+{
+    elib::mpsc_ring<int, 4> ring;
+
+    REQUIRE(ring.empty());
+    REQUIRE(ring.capacity() == 4);
+
+    REQUIRE(ring.push_back(1));
+    REQUIRE(ring.push_back(2));
+    REQUIRE(ring.push_back(3));
+    REQUIRE(ring.push_back(4));
+    REQUIRE(ring.full());
+    REQUIRE_FALSE(ring.push_back(5));
+
+    REQUIRE(ring.front() == 1);
+    REQUIRE(ring.pop_front());
+    REQUIRE(ring.front() == 2);
+    REQUIRE(ring.size() == 3);
+
+    // the freed slot is reusable on the next lap
+    REQUIRE(ring.push_back(5));
+    REQUIRE(ring.full());
+
+    std::array<int, 8> out{};
+    REQUIRE(ring.pop_n(out.data(), out.size()) == 4);
+    REQUIRE(out[0] == 2);
+    REQUIRE(out[3] == 5);
+
+    REQUIRE(ring.push_back(6));
+    ring.clear();
+    REQUIRE(ring.empty());
+    REQUIRE_FALSE(ring.pop_front());
+}
+
+TEST_CASE("elib::mpsc_ring: Move keeps pending elements", "[mpsc_ring]")
+{
+    elib::mpsc_ring<int, 4> ring;
+    REQUIRE(ring.push_back(1));
+    REQUIRE(ring.push_back(2));
+    REQUIRE(ring.pop_front());
+    REQUIRE(ring.push_back(3));
+
+    elib::mpsc_ring<int, 4> moved{std::move(ring)};
+    REQUIRE(ring.empty());
+    REQUIRE(ring.push_back(7));
+    REQUIRE(ring.front() == 7);
+
+    REQUIRE(moved.size() == 2);
+    REQUIRE(moved.front() == 2);
+    REQUIRE(moved.pop_front());
+    REQUIRE(moved.front() == 3);
+}
+
+TEST_CASE("elib::mpsc_ring: Multi-producer stress", "[mpsc_ring]")
+{
+    constexpr std::uint32_t producer_num = 4;
+    constexpr std::uint32_t message_num = 200'000; // per producer
+    elib::mpsc_ring<std::uint32_t, 64> ring;
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t id = 0; id < producer_num; ++id)
+    {
+        producers.emplace_back([&ring, id] {
+            // producer id in the top byte, sequence number below
+            for (std::uint32_t next = 0; next < message_num;)
+            {
+                if (ring.push_back((id << 24) | next))
+                    ++next;
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::array<std::uint32_t, producer_num> expected{};
+    bool in_order = true;
+    std::array<std::uint32_t, 5> batch{};
+
+    for (std::uint32_t received = 0; received < producer_num * message_num;)
+    {
+        const auto count = ring.pop_n(batch.data(), batch.size());
+        if (!count)
+            std::this_thread::yield();
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // every producer's messages arrive in its own order
+            const std::uint32_t id = batch[i] >> 24;
+            in_order &= id < producer_num && (batch[i] & 0xFFFFFF) == expected[id]++;
+        }
+
+        received += static_cast<std::uint32_t>(count);
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(ring.empty());
+    REQUIRE(ring.size() == 0);
+}
+
+TEST_CASE("elib::mpsc_ring: Contiguous front run", "[mpsc_ring]")
+{
+    elib::mpsc_ring<int, 4> ring;
+    REQUIRE(ring.array_one().empty());
+
+    REQUIRE(ring.push_back(0));
+    REQUIRE(ring.push_back(0));
+    REQUIRE(ring.push_back(0));
+    ring.erase_begin(3);
+
+    REQUIRE(ring.push_back(1));
+    REQUIRE(ring.push_back(2));
+    REQUIRE(ring.push_back(3));
+
+    // 1 at the storage end, 2 and 3 wrapped to the storage begin
+    REQUIRE(ring.array_one().size() == 1);
+    REQUIRE(ring.array_one()[0] == 1);
+
+    ring.erase_begin(1);
+    REQUIRE(ring.array_one().size() == 2);
+    REQUIRE(ring.array_one()[1] == 3);
+
+    ring.erase_begin(10);
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("elib::mpsc_ring: Backing store of event_loop", "[mpsc_ring][event_loop]")
+{
+    constexpr int producer_num = 3;
+    constexpr int event_num = 5000; // per producer
+
+    elib::event_loop<int, 16, elib::mpsc_ring> loop;
+    loop.set_max_events_per_call(8);
+
+    int received = 0;
+    long long sum = 0;
+    loop.set_handler([&](const int& value) { ++received; sum += value; });
+
+    std::vector<std::thread> producers;
+    for (int id = 0; id < producer_num; ++id)
+    {
+        producers.emplace_back([&loop] {
+            for (int value = 1; value <= event_num;)
+            {
+                if (loop.push(value))
+                    ++value;
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    while (received < producer_num * event_num)
+    {
+        if (loop.empty())
+            std::this_thread::yield();
+        loop.run();
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    REQUIRE(sum == producer_num * (static_cast<long long>(event_num) * (event_num + 1) / 2));
+    REQUIRE(loop.empty());
+}
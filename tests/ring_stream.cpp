@@ -0,0 +1,235 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/ring_stream.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace
+{
+  struct sample
+  {
+    std::uint16_t id;
+    std::int32_t value;
+  };
+  ELIB_SERIALIZE(sample, id, value)
+
+  struct batch
+  {
+    std::uint8_t tag;
+    std::array<std::uint16_t, 3> words;
+    elib::array<sample, 4> samples;
+    sample last[1];
+  };
+  ELIB_SERIALIZE(batch, tag, words, samples, last)
+
+  struct record
+  {
+    std::uint32_t id;
+    std::array<std::uint8_t, 200> payload;
+    elib::array<std::uint16_t, 64> readings;
+  };
+  ELIB_SERIALIZE(record, id, payload, readings)
+
+  // leaves `offset` free slots at the front of an empty ring, so that the next bytes wrap
+  template<std::size_t Capacity>
+  void rotate(elib::circular_buffer<std::uint8_t, Capacity>& ring, std::size_t offset)
+  {
+    for (std::size_t index = 0; index < offset; ++index)
+      ring.push_back(0);
+
+    ring.erase_begin(offset);
+  }
+}
+
+using namespace elib::data;
+
+TEST_CASE("elib::data::ring_input_stream: fields across the wrap", "[data][ring_stream]") {
+    // every field of the same 15-byte payload straddles the wrap at some offset
+    for (std::size_t offset = 0; offset < 16; ++offset)
+    {
+        elib::circular_buffer<std::uint8_t, 16> ring;
+        rotate(ring, offset);
+
+        ring_output_stream out{ring};
+        REQUIRE(out.write(std::uint32_t{0xA1B2C3D4}));
+        REQUIRE(out.write_be(std::uint16_t{0x1234}));
+        REQUIRE(out.write_varint(std::int32_t{-300}));
+        REQUIRE(out.write(sample{7, -8}));
+        REQUIRE(out.write(std::uint8_t{0x55}));
+        REQUIRE(out.pos() == 15);
+        REQUIRE(ring.size() == 15);
+
+        ring_input_stream in{ring};
+        REQUIRE(in.size() == 15);
+
+        std::uint32_t word{};
+        std::uint16_t be{};
+        std::int32_t varint{};
+        sample message{};
+        std::uint8_t byte{};
+
+        REQUIRE(in.read(word));
+        REQUIRE(in.read_be(be));
+        REQUIRE(in.read_varint(varint));
+        REQUIRE(in.read(message));
+        REQUIRE(in.read(byte));
+        REQUIRE(in.pos() == 15);
+        REQUIRE_FALSE(in.overflow());
+
+        REQUIRE(word == 0xA1B2C3D4);
+        REQUIRE(be == 0x1234);
+        REQUIRE(varint == -300);
+        REQUIRE(message.id == 7);
+        REQUIRE(message.value == -8);
+        REQUIRE(byte == 0x55);
+
+        REQUIRE_FALSE(in.read(byte));
+        REQUIRE(in.overflow());
+
+        ring.erase_begin(in.pos());
+        REQUIRE(ring.empty());
+    }
+}
+
+TEST_CASE("elib::data::ring_input_stream: messages with arrays across the wrap", "[data][ring_stream]") {
+    batch sent{};
+    sent.tag = 0x5A;
+    sent.words = {0x1111, 0x2222, 0x3333};
+    sent.samples.push_back(sample{1, -1});
+    sent.samples.push_back(sample{2, -2});
+    sent.last[0] = sample{3, -3};
+
+    // 1 + 6 + (1 + 2 * 6) + 6 bytes, read field by field whenever the message straddles
+    for (std::size_t offset = 0; offset < 32; ++offset)
+    {
+        elib::circular_buffer<std::uint8_t, 32> ring;
+        rotate(ring, offset);
+
+        ring_output_stream out{ring};
+        REQUIRE(out.write(sent));
+        REQUIRE(out.pos() == 26);
+
+        ring_input_stream in{ring};
+        batch received{};
+        REQUIRE(in.read(received));
+        REQUIRE(in.pos() == 26);
+
+        REQUIRE(received.tag == 0x5A);
+        REQUIRE(received.words == sent.words);
+        REQUIRE(received.samples.size() == 2);
+        REQUIRE(received.samples[1].value == -2);
+        REQUIRE(received.last[0].id == 3);
+
+        // a truncated message is not consumed
+        ring_input_stream truncated{ring.array_one(), ring.array_two().first(ring.array_two().size() / 2)};
+        if (truncated.size() < 26)
+        {
+            REQUIRE_FALSE(truncated.read(received));
+            REQUIRE(truncated.overflow());
+            REQUIRE(truncated.pos() == 0);
+        }
+    }
+}
+
+TEST_CASE("elib::data::ring_input_stream: bulk reads", "[data][ring_stream]") {
+    elib::circular_buffer<std::uint8_t, 8> ring;
+    rotate(ring, 5);
+
+    for (std::uint8_t value = 1; value <= 7; ++value)
+        ring.push_back(value);
+    REQUIRE_FALSE(ring.array_two().empty());
+
+    ring_input_stream in{ring};
+    std::array<std::uint8_t, 6> bytes{};
+
+    REQUIRE(in.read(elib::span<std::uint8_t>{bytes}));
+    REQUIRE(bytes == std::array<std::uint8_t, 6>{1, 2, 3, 4, 5, 6});
+
+    REQUIRE_FALSE(in.read(elib::span<std::uint8_t>{bytes}));
+    REQUIRE(in.overflow());
+    REQUIRE(in.pos() == 6);
+
+    REQUIRE(in.seek(2));
+    std::array<std::uint8_t, 3> triple{};
+    in >> triple;
+    REQUIRE(triple == std::array<std::uint8_t, 3>{3, 4, 5});
+}
+
+TEST_CASE("elib::data::ring_input_stream: truncated input", "[data][ring_stream]") {
+    elib::circular_buffer<std::uint8_t, 8> ring;
+    rotate(ring, 6);
+
+    ring.push_back(0x80); // unterminated varint across the wrap
+    ring.push_back(0x80);
+    ring.push_back(0x80);
+
+    ring_input_stream in{ring};
+    std::uint32_t value = 9;
+
+    REQUIRE_FALSE(in.read_varint(value));
+    REQUIRE_FALSE(in.read(value));
+    REQUIRE(in.overflow());
+    REQUIRE(in.pos() == 0);
+    REQUIRE(value == 9);
+
+    ring_input_stream empty{elib::span<const std::uint8_t>{}, elib::span<const std::uint8_t>{}};
+    REQUIRE(empty.read_all());
+    REQUIRE_FALSE(empty.read_le(value));
+}
+
+TEST_CASE("elib::data::ring_output_stream: fields are appended whole", "[data][ring_stream]") {
+    elib::circular_buffer<std::uint8_t, 6> ring;
+    ring_output_stream out{ring};
+
+    REQUIRE(out.write_le(std::uint32_t{0x01020304}));
+    REQUIRE(ring.front() == 0x04);
+
+    REQUIRE_FALSE(out.write(sample{}));
+    REQUIRE(out.overflow());
+    REQUIRE(ring.size() == 4);
+
+    // the consumer frees space, writes go on
+    ring.erase_begin(4);
+    REQUIRE(out.write(sample{1, 2}));
+    REQUIRE(out.pos() == 10);
+    REQUIRE(ring.full());
+}
+
+TEST_CASE("elib::data::ring_output_stream: messages with large arrays across the wrap", "[data][ring_stream]") {
+    record sent{};
+    sent.id = 0xCAFE;
+    for (std::size_t index = 0; index < sent.payload.size(); ++index)
+        sent.payload[index] = static_cast<std::uint8_t>(index);
+    for (std::uint16_t value = 0; value < 40; ++value)
+        sent.readings.push_back(static_cast<std::uint16_t>(value * 1000));
+
+    // 4 + 200 + (1 + 40 * 2) bytes, encoded field by field whenever the free space wraps
+    constexpr std::size_t size = 285;
+    REQUIRE(serialized_size(sent) == size);
+
+    for (std::size_t offset = 0; offset < 512; offset += 7)
+    {
+        elib::circular_buffer<std::uint8_t, 512> ring;
+        rotate(ring, offset);
+
+        ring_output_stream out{ring};
+        REQUIRE(out.write(sent));
+        REQUIRE(out.pos() == size);
+        REQUIRE(ring.size() == size);
+
+        ring_input_stream in{ring};
+        record received{};
+        REQUIRE(in.read(received));
+        REQUIRE(in.pos() == size);
+
+        REQUIRE(received.id == sent.id);
+        REQUIRE(received.payload == sent.payload);
+        REQUIRE(received.readings.size() == 40);
+        REQUIRE(std::equal(received.readings.begin(), received.readings.end(), sent.readings.begin()));
+
+        // does not fit the rest: nothing is appended
+        REQUIRE_FALSE(out.write(sent));
+        REQUIRE(ring.size() == size);
+    }
+}
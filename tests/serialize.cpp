@@ -0,0 +1,191 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/serialize.h>
+#include <elib/stream.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace app
+{
+  enum class mode : std::uint8_t
+  {
+    idle,
+    active
+  };
+
+  struct point
+  {
+    std::int16_t x;
+    std::int16_t y;
+  };
+  ELIB_SERIALIZE(point, x, y)
+
+  struct header
+  {
+    std::uint16_t id;
+    mode state;
+    std::uint8_t flags[2];
+    point origin;
+  };
+  ELIB_SERIALIZE(header, id, state, flags, origin)
+
+  struct track
+  {
+    header head;
+    std::array<point, 2> corners;
+    elib::array<point, 4> path;
+    elib::array<std::uint8_t, 200> samples;
+  };
+  ELIB_SERIALIZE(track, head, corners, path, samples)
+
+  struct unlisted
+  {
+    int value;
+  };
+}
+
+using namespace elib::data;
+
+static_assert(is_message_v<app::point>);
+static_assert(!is_message_v<app::unlisted>);
+static_assert(!is_message_v<int>);
+
+static_assert(is_fixed_size_v<app::header>);
+static_assert(serialized_max_size_v<app::point> == 4);
+static_assert(serialized_max_size_v<app::header> == 9);
+static_assert(serialized_size(app::header{}) == 9);
+
+static_assert(!is_fixed_size_v<app::track>);
+static_assert(serialized_max_size_v<app::track> == 9 + 8 + (1 + 16) + (2 + 200));
+
+TEST_CASE("elib::data::serialize: fixed-size messages", "[data][serialize]") {
+    const app::header source{0x1234, app::mode::active, {7, 8}, {-1, 2}};
+
+    std::array<std::uint8_t, 9> data{};
+    output_stream out{data};
+
+    REQUIRE(out.write(source));
+    REQUIRE(out.pos() == 9);
+
+    // fields in listed order, scalars in host byte order like output_stream::write()
+    std::uint16_t id{};
+    std::memcpy(&id, data.data(), sizeof(id));
+    REQUIRE(id == 0x1234);
+    REQUIRE(data[2] == 1);
+    REQUIRE(data[3] == 7);
+    REQUIRE(data[4] == 8);
+
+    SECTION("Round trip")
+    {
+        app::header decoded{};
+        input_stream in{data};
+
+        REQUIRE(in.read(decoded));
+        REQUIRE(in.pos() == 9);
+        REQUIRE(decoded.id == 0x1234);
+        REQUIRE(decoded.state == app::mode::active);
+        REQUIRE(decoded.flags[0] == 7);
+        REQUIRE(decoded.flags[1] == 8);
+        REQUIRE(decoded.origin.x == -1);
+        REQUIRE(decoded.origin.y == 2);
+    }
+
+    SECTION("Stream operators")
+    {
+        std::array<std::uint8_t, 8> points{};
+        output_stream pout{points};
+        pout << app::point{1, 2} << app::point{3, 4};
+        REQUIRE(pout.pos() == 8);
+
+        app::point first{};
+        app::point second{};
+        input_stream pin{points};
+        pin >> first >> second;
+        REQUIRE(first.x == 1);
+        REQUIRE(second.y == 4);
+    }
+
+    SECTION("A message that does not fit is not written")
+    {
+        REQUIRE_FALSE(out.write(app::point{}));
+        REQUIRE(out.overflow());
+        REQUIRE(out.pos() == 9);
+    }
+
+    SECTION("Truncated input")
+    {
+        input_stream in{data.data(), 8};
+        app::header decoded{};
+
+        REQUIRE_FALSE(in.read(decoded));
+        REQUIRE(in.overflow());
+        REQUIRE(in.pos() == 0);
+    }
+}
+
+TEST_CASE("elib::data::serialize: variable-size messages", "[data][serialize]") {
+    app::track source{};
+    source.head.id = 42;
+    source.corners = {app::point{1, 1}, app::point{-5, 5}};
+    source.path.push_back(app::point{10, 20});
+    source.path.push_back(app::point{30, 40});
+    for (std::uint8_t sample = 0; sample < 150; ++sample)
+        source.samples.push_back(sample);
+
+    const std::size_t size = serialized_size(source);
+    REQUIRE(size == 9 + 8 + (1 + 8) + (2 + 150));
+
+    std::array<std::uint8_t, serialized_max_size_v<app::track>> data{};
+    output_stream out{data};
+    REQUIRE(out.write(source));
+    REQUIRE(out.pos() == size);
+
+    SECTION("Round trip")
+    {
+        app::track decoded{};
+        decoded.path.push_back(app::point{}); // replaced, not appended
+
+        input_stream in{data.data(), size};
+        REQUIRE(in.read(decoded));
+        REQUIRE(in.pos() == size);
+
+        REQUIRE(decoded.head.id == 42);
+        REQUIRE(decoded.corners[1].x == -5);
+        REQUIRE(decoded.path.size() == 2);
+        REQUIRE(decoded.path[1].y == 40);
+        REQUIRE(decoded.samples.size() == 150);
+        REQUIRE(decoded.samples[149] == 149);
+    }
+
+    SECTION("Truncated input")
+    {
+        for (std::size_t truncated : {std::size_t{0}, std::size_t{17}, std::size_t{20}, size - 1})
+        {
+            app::track decoded{};
+            input_stream in{data.data(), truncated};
+
+            REQUIRE_FALSE(in.read(decoded));
+            REQUIRE(in.overflow());
+            REQUIRE(in.pos() == 0);
+        }
+    }
+
+    SECTION("Element count above the capacity")
+    {
+        data[17] = 5; // path holds at most 4 points
+
+        app::track decoded{};
+        REQUIRE(deserialize(data.data(), data.size(), decoded) == 0);
+    }
+
+    SECTION("A message that does not fit is not written")
+    {
+        std::array<std::uint8_t, 100> small{};
+        output_stream out_small{small};
+
+        REQUIRE_FALSE(out_small.write(source));
+        REQUIRE(out_small.overflow());
+        REQUIRE(out_small.pos() == 0);
+    }
+}
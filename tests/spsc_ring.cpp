@@ -0,0 +1,182 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/spsc_ring.h>
+#include <elib/event_loop.h>
+#include <array>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST_CASE("elib::spsc_ring: Push and pop elements", "[spsc_ring]")
+{
+    elib::spsc_ring<int, 4> ring;
+
+    REQUIRE(ring.empty());
+    REQUIRE(ring.capacity() == 4);
+
+    REQUIRE(ring.push_back(1));
+    REQUIRE(ring.push_back(2));
+    REQUIRE(ring.push_back(3));
+    REQUIRE(ring.push_back(4));
+    REQUIRE(ring.full());
+    REQUIRE_FALSE(ring.push_back(5));
+
+    REQUIRE(ring.front() == 1);
+    REQUIRE(ring.pop_front());
+    REQUIRE(ring.front() == 2);
+    REQUIRE(ring.size() == 3);
+
+    ring.clear();
+    REQUIRE(ring.empty());
+    REQUIRE_FALSE(ring.pop_front());
+}
+
+TEST_CASE("elib::spsc_ring: Batch push and pop across the wrap", "[spsc_ring]")
+{
+    elib::spsc_ring<int, 8> ring;
+    std::array<int, 8> in{};
+    std::iota(in.begin(), in.end(), 1);
+
+    // move the indices close to the end of the storage
+    REQUIRE(ring.push_n(in.data(), 6) == 6);
+    std::array<int, 8> out{};
+    REQUIRE(ring.pop_n(out.data(), 6) == 6);
+    REQUIRE(out[5] == 6);
+
+    // wraps: 2 elements at the end of storage, 3 at the beginning
+    REQUIRE(ring.push_n(in.data(), 5) == 5);
+    REQUIRE(ring.size() == 5);
+
+    // only 3 slots left
+    REQUIRE(ring.push_n(in.data(), 8) == 3);
+    REQUIRE(ring.full());
+
+    out = {};
+    REQUIRE(ring.pop_n(out.data(), 8) == 8);
+    REQUIRE(out == std::array<int, 8>{1, 2, 3, 4, 5, 1, 2, 3});
+    REQUIRE(ring.pop_n(out.data(), 8) == 0);
+}
+
+TEST_CASE("elib::spsc_ring: Two-thread stress", "[spsc_ring]")
+{
+    constexpr std::uint32_t message_num = 1'000'000;
+    elib::spsc_ring<std::uint32_t, 64> ring;
+
+    std::thread producer([&ring] {
+        std::uint32_t next = 0;
+        std::array<std::uint32_t, 7> batch{};
+
+        while (next < message_num)
+        {
+            // alternate single and batch pushes
+            if (next % 2)
+            {
+                if (ring.push_back(next))
+                    ++next;
+                else
+                    std::this_thread::yield();
+                continue;
+            }
+
+            std::uint32_t count = 0;
+            for (; count < batch.size() && next + count < message_num; ++count)
+                batch[count] = next + count;
+
+            const auto pushed = static_cast<std::uint32_t>(ring.push_n(batch.data(), count));
+            if (!pushed)
+                std::this_thread::yield();
+            next += pushed;
+        }
+    });
+
+    std::uint32_t expected = 0;
+    bool in_order = true;
+    std::array<std::uint32_t, 5> batch{};
+
+    while (expected < message_num)
+    {
+        if (expected % 3)
+        {
+            if (!ring.empty())
+            {
+                in_order &= ring.front() == expected++;
+                ring.pop_front();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+
+        const auto count = ring.pop_n(batch.data(), batch.size());
+        if (!count)
+            std::this_thread::yield();
+        for (std::size_t i = 0; i < count; ++i)
+            in_order &= batch[i] == expected++;
+    }
+
+    producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("elib::spsc_ring: Contiguous front run", "[spsc_ring]")
+{
+    elib::spsc_ring<int, 4> ring;
+    REQUIRE(ring.array_one().empty());
+
+    REQUIRE(ring.push_back(0));
+    REQUIRE(ring.push_back(0));
+    REQUIRE(ring.push_back(0));
+    ring.erase_begin(3);
+
+    REQUIRE(ring.push_back(1));
+    REQUIRE(ring.push_back(2));
+    REQUIRE(ring.push_back(3));
+
+    // 1 at the storage end, 2 and 3 wrapped to the storage begin
+    REQUIRE(ring.array_one().size() == 1);
+    REQUIRE(ring.array_one()[0] == 1);
+
+    ring.erase_begin(1);
+    REQUIRE(ring.array_one().size() == 2);
+    REQUIRE(ring.array_one()[1] == 3);
+
+    ring.erase_begin(10);
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("elib::spsc_ring: Backing store of event_loop", "[spsc_ring][event_loop]")
+{
+    constexpr int event_num = 10000;
+
+    elib::event_loop<int, 16, elib::spsc_ring> loop;
+    loop.set_max_events_per_call(8);
+
+    int expected = 0;
+    bool in_order = true;
+    loop.set_handler([&](const int& value) { in_order &= value == expected++; });
+
+    std::thread producer([&loop] {
+        for (int value = 0; value < event_num;)
+        {
+            if (loop.push(value))
+                ++value;
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    while (expected < event_num)
+    {
+        if (loop.empty())
+            std::this_thread::yield();
+        loop.run();
+    }
+
+    producer.join();
+
+    REQUIRE(in_order);
+    REQUIRE(loop.empty());
+}
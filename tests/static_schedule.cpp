@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/static_schedule.h>
+#include <elib/event_loop.h>
+#include <elib/task.h>
+#include <vector>
+
+namespace
+{
+    std::vector<int> trace;
+
+    // any class with run(), no kernel base needed
+    struct plain_job
+    {
+        int id;
+        void run() { trace.push_back(id); }
+    };
+
+    // a static task must not be registered, or the kernel would run it too
+    class static_task : public elib::task
+    {
+    public:
+        static_task() : elib::task{elib::kernel::static_dispatch} {}
+        void run() override { trace.push_back(2); }
+    };
+
+    plain_job job_a{0};
+    plain_job job_b{1};
+    static_task virtual_job;
+    elib::event_loop<int, 4> static_loop{elib::kernel::static_dispatch};
+
+    using schedule = elib::kernel::static_schedule<job_a, job_b, virtual_job, static_loop>;
+}
+
+TEST_CASE("elib::kernel::static_schedule: Runs the task table", "[kernel][static_schedule]")
+{
+    trace.clear();
+    static_assert(schedule::size() == 4);
+
+    SECTION("run_all runs every task in order")
+    {
+        schedule::run_all();
+        REQUIRE(trace == std::vector<int>{0, 1, 2});
+    }
+
+    SECTION("process_tasks runs one task per call, round-robin")
+    {
+        // a schedule of its own: the cursor starts at the first task
+        using round_robin = elib::kernel::static_schedule<job_a, job_b, virtual_job>;
+
+        for (int call = 0; call < 5; ++call)
+            round_robin::process_tasks();
+
+        REQUIRE(trace == std::vector<int>{0, 1, 2, 0, 1});
+    }
+}
+
+TEST_CASE("elib::kernel::static_schedule: Coexists with dynamic tasks", "[kernel][static_schedule]")
+{
+    trace.clear();
+
+    // static tasks are not in the registry
+    REQUIRE_FALSE(elib::kernel::process_tasks());
+
+    int received = 0;
+    static_loop.set_handler([&received](const int& value) { received = value; });
+    REQUIRE(static_loop.push(42));
+
+    class dynamic_task : public elib::task
+    {
+    public:
+        int run_count = 0;
+        void run() override { run_count++; }
+    };
+
+    dynamic_task dynamic;
+
+    for (std::size_t call = 0; call < schedule::size(); ++call)
+        REQUIRE(schedule::process_all());
+
+    REQUIRE(received == 42);
+    REQUIRE(dynamic.run_count == static_cast<int>(schedule::size()));
+    REQUIRE(trace.size() == 3);
+
+    static_loop.set_handler(nullptr);
+}
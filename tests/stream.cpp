@@ -299,3 +299,260 @@ TEST_CASE("elib::data: write operations", "[data][stream]") {
         REQUIRE(stream.overflow());    // and overflow flag set
     }
 }
+
+TEST_CASE("elib::data: span read/write", "[data][stream]") {
+    const std::uint16_t values[3]{0x1122, 0x3344, 0x5566};
+    std::array<std::uint8_t, 8> data{};
+
+    elib::data::output_stream out{data};
+    REQUIRE(out.write(elib::span<const std::uint16_t>{values}));
+    REQUIRE(out.pos() == sizeof(values));
+
+    // does not fit: nothing is written
+    REQUIRE_FALSE(out.write(elib::span<const std::uint16_t>{values}));
+    REQUIRE(out.pos() == sizeof(values));
+    REQUIRE(out.overflow());
+
+    std::uint16_t result[3]{};
+    elib::data::input_stream in{data};
+    in >> elib::span<std::uint16_t>{result};
+    REQUIRE(std::memcmp(result, values, sizeof(values)) == 0);
+    REQUIRE(in.pos() == sizeof(values));
+
+    REQUIRE_FALSE(in.read(elib::span<std::uint16_t>{result}));
+    REQUIRE(in.overflow());
+
+    // empty span
+    REQUIRE(in.seek(0));
+    REQUIRE(in.read(elib::span<std::uint16_t>{}));
+    REQUIRE(in.pos() == 0);
+}
+
+TEST_CASE("elib::data: write_all/read_all check bounds once per pack", "[data][stream]") {
+    enum class mode : std::uint8_t { idle = 1, run = 2 };
+
+    const std::uint8_t id = 0x7F;
+    const std::uint32_t counter = 0xA1B2C3D4;
+    const mode state = mode::run;
+    const std::array<std::int16_t, 2> samples{-1, 300};
+    const char tag[3]{'e', 'l', 'b'};
+    constexpr std::size_t pack_size = 1 + 4 + 1 + 4 + 3;
+
+    std::array<std::uint8_t, pack_size> data{};
+    elib::data::output_stream out{data};
+
+    REQUIRE(out.write_all(id, counter, state, samples, tag));
+    REQUIRE(out.pos() == pack_size);
+    REQUIRE_FALSE(out.overflow());
+
+    SECTION("Round trip")
+    {
+        std::uint8_t id_in{};
+        std::uint32_t counter_in{};
+        mode state_in{};
+        std::array<std::int16_t, 2> samples_in{};
+        char tag_in[3]{};
+
+        elib::data::input_stream in{data};
+        REQUIRE(in.read_all(id_in, counter_in, state_in, samples_in, tag_in));
+        REQUIRE(in.pos() == pack_size);
+
+        REQUIRE(id_in == id);
+        REQUIRE(counter_in == counter);
+        REQUIRE(state_in == state);
+        REQUIRE(samples_in == samples);
+        REQUIRE(std::memcmp(tag_in, tag, sizeof(tag)) == 0);
+    }
+
+    SECTION("A pack that does not fit is not written partially")
+    {
+        REQUIRE(out.seek(1));
+
+        REQUIRE_FALSE(out.write_all(std::uint8_t{0}, counter, state, samples, tag));
+        REQUIRE(out.overflow());
+        REQUIRE(data[1] == static_cast<std::uint8_t>(counter)); // first field untouched
+    }
+
+    SECTION("A pack that cannot be read leaves the fields untouched")
+    {
+        std::uint8_t id_in{};
+        std::uint32_t counter_in{};
+        std::uint64_t too_big{};
+        char tag_in[3]{};
+
+        elib::data::input_stream in{data};
+        REQUIRE_FALSE(in.read_all(id_in, counter_in, too_big, tag_in));
+        REQUIRE(in.overflow());
+        REQUIRE(id_in == 0);
+        REQUIRE(in.pos() == 0);
+    }
+}
+
+TEST_CASE("elib::data: reserve returns a window for unchecked writes", "[data][stream]") {
+    std::array<std::uint8_t, 8> data{};
+    elib::data::output_stream out{data};
+
+    out << std::uint8_t{0x01};
+
+    auto window = out.reserve(6);
+    REQUIRE(window);
+    REQUIRE(window.size() == 6);
+    REQUIRE(out.pos() == 7); // the stream moved past the window
+
+    window << std::uint16_t{0x0302} << std::uint8_t{0x04};
+    window.write(std::array<std::uint8_t, 3>{0x05, 0x06, 0x07});
+    REQUIRE(window.pos() == 6);
+
+    out << std::uint8_t{0x08};
+    REQUIRE(data == std::array<std::uint8_t, 8>{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+
+    SECTION("A window that does not fit is invalid")
+    {
+        const auto invalid = out.reserve(1);
+        REQUIRE_FALSE(invalid);
+        REQUIRE(invalid.size() == 0);
+        REQUIRE(out.overflow());
+        REQUIRE(out.pos() == 8);
+    }
+
+    SECTION("Zero-sized window")
+    {
+        REQUIRE(out.reserve(0));
+        REQUIRE_FALSE(out.overflow());
+    }
+}
+
+TEST_CASE("elib::data: explicit byte order", "[data][stream]") {
+    std::array<std::uint8_t, 15> data{};
+    elib::data::output_stream out{data};
+
+    REQUIRE(out.write_be(std::uint32_t{0x11223344}));
+    REQUIRE(out.write_le(std::uint16_t{0x5566}));
+    REQUIRE(out.write_be(std::int8_t{-2}));
+    REQUIRE(out.write_be(1.5));
+    REQUIRE(out.pos() == 15);
+
+    REQUIRE_FALSE(out.write_le(std::uint8_t{0}));
+    REQUIRE(out.overflow());
+
+    REQUIRE(data[0] == 0x11);
+    REQUIRE(data[3] == 0x44);
+    REQUIRE(data[4] == 0x66);
+    REQUIRE(data[5] == 0x55);
+    REQUIRE(data[6] == 0xFE);
+    REQUIRE(data[7] == 0x3F); // IEEE 754 1.5: 0x3FF8000000000000
+    REQUIRE(data[8] == 0xF8);
+
+    std::uint32_t be{};
+    std::uint16_t le{};
+    std::int8_t byte{};
+    double real{};
+
+    elib::data::input_stream in{data};
+    REQUIRE(in.read_be(be));
+    REQUIRE(in.read_le(le));
+    REQUIRE(in.read_be(byte));
+    REQUIRE(in.read_be(real));
+
+    REQUIRE(be == 0x11223344);
+    REQUIRE(le == 0x5566);
+    REQUIRE(byte == -2);
+    REQUIRE(real == 1.5);
+
+    REQUIRE_FALSE(in.read_le(le));
+    REQUIRE(in.overflow());
+}
+
+namespace
+{
+    struct reading
+    {
+        std::uint8_t channel;
+        std::int16_t value;
+    };
+    ELIB_SERIALIZE(reading, channel, value)
+}
+
+TEST_CASE("elib::data: varint fields", "[data][stream]") {
+    std::array<std::uint8_t, 16> data{};
+    elib::data::output_stream out{data};
+
+    REQUIRE(out.write_varint(std::uint32_t{300}));   // 0xAC 0x02
+    REQUIRE(out.write_varint(std::int16_t{-1}));     // 0x01
+    REQUIRE(out.write_varint(std::uint64_t{1} << 63)); // 10 bytes
+    REQUIRE(out.pos() == 13);
+
+    SECTION("Round trip")
+    {
+        REQUIRE(data[0] == 0xAC);
+        REQUIRE(data[1] == 0x02);
+        REQUIRE(data[2] == 0x01);
+
+        std::uint32_t first{};
+        std::int16_t second{};
+        std::uint64_t third{};
+
+        elib::data::input_stream in{data};
+        REQUIRE(in.read_varint(first));
+        REQUIRE(in.read_varint(second));
+        REQUIRE(in.read_varint(third));
+        REQUIRE(in.pos() == 13);
+
+        REQUIRE(first == 300);
+        REQUIRE(second == -1);
+        REQUIRE(third == std::uint64_t{1} << 63);
+    }
+
+    SECTION("A value that does not fit is not written partially")
+    {
+        REQUIRE_FALSE(out.write_varint(std::uint32_t{1} << 21)); // 4 bytes, 3 left
+        REQUIRE(out.overflow());
+        REQUIRE(out.pos() == 13);
+
+        REQUIRE(out.seek(13));
+        REQUIRE(out.write_varint(std::uint32_t{(1u << 21) - 1})); // 3 bytes
+        REQUIRE(out.pos() == 16);
+    }
+
+    SECTION("Overflow is sticky")
+    {
+        REQUIRE_FALSE(out.write_varint(std::uint64_t{1} << 63)); // 10 bytes, 3 left
+        REQUIRE_FALSE(out.write_varint(std::uint8_t{1}));         // would fit, but the stream has overflowed
+        REQUIRE(out.pos() == 13);
+
+        elib::data::input_stream in{data};
+        std::uint8_t small{};
+        std::uint32_t value{};
+        REQUIRE_FALSE(in.read_varint(small)); // 300 does not fit
+        REQUIRE_FALSE(in.read_varint(value)); // would fit, but the stream has overflowed
+        REQUIRE(in.pos() == 0);
+        REQUIRE(value == 0);
+
+        reading message{};
+        REQUIRE_FALSE(in.read(message)); // 3 bytes would fit as well
+        REQUIRE(in.pos() == 0);
+        REQUIRE(message.channel == 0);
+    }
+
+    SECTION("Truncated input")
+    {
+        elib::data::input_stream in{data.data(), 12};
+        std::uint64_t value{};
+
+        REQUIRE(in.seek(3));
+        REQUIRE_FALSE(in.read_varint(value));
+        REQUIRE(in.overflow());
+        REQUIRE(in.pos() == 3);
+        REQUIRE(value == 0);
+    }
+
+    SECTION("Values too large for the destination type")
+    {
+        elib::data::input_stream in{data};
+        std::uint8_t value{};
+
+        REQUIRE(in.read_varint(value) == false); // 300
+        REQUIRE(in.overflow());
+        REQUIRE(in.pos() == 0);
+    }
+}
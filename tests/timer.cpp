@@ -3,6 +3,7 @@
 #include <catch2/reporters/catch_reporter_registrars.hpp>
 #include <cstdint>
 #include <chrono>
+#include <vector>
 
 #include <elib/time/system_clock.h>
 #include <elib/time/timer.h>
@@ -316,4 +317,57 @@ TEST_CASE("elib::time::Timer: setCallback on Invalid Timer", "[time][timer]")
 
     // This should not crash or cause side effects
     timer.set_callback([]() { /* empty */ });
-}
\ No newline at end of file
+}
+
+TEST_CASE("elib::time::Timer: Next Expiry", "[time][timer]")
+{
+    using clock = time::timer::clock;
+
+    REQUIRE(time::timer::next_expiry() == clock::duration::max());
+
+    auto slow = time::timer::register_timer(milliseconds{100}, []() {});
+    auto fast = time::timer::register_timer(milliseconds{40}, []() {});
+
+    // registered but not running
+    REQUIRE(time::timer::next_expiry() == clock::duration::max());
+
+    slow.start();
+    fast.start();
+    REQUIRE(time::timer::next_expiry() == clock::duration{40});
+
+    advance_time(15);
+    REQUIRE(time::timer::next_expiry() == clock::duration{25});
+
+    fast.stop();
+    REQUIRE(time::timer::next_expiry() == clock::duration{85});
+}
+
+TEST_CASE("elib::time::Timer: Tickless Clock Jump Keeps Phase", "[time][timer]")
+{
+    using clock = time::timer::clock;
+
+    int periodic = 0;
+    int single = 0;
+    std::vector<clock::rep> fired_at;
+
+    auto timer = time::timer::register_timer(milliseconds{30}, [&]() {
+        periodic++;
+        fired_at.push_back(clock::ticks());
+    });
+    timer.start();
+    REQUIRE(time::timer::single_shot(milliseconds{5000}, [&]() { single++; }));
+
+    // simulated tickless sleep of 10,000 ticks
+    time::timer::advance_clock(clock::duration{10000});
+
+    REQUIRE(clock::ticks() == 10000);
+    REQUIRE(single == 1);
+    REQUIRE(periodic == 10000 / 30);
+    REQUIRE(fired_at.front() == 30);
+    REQUIRE(fired_at.back() == 9990);
+
+    // phase is preserved: the next expiry is on the original 30 ms grid
+    REQUIRE(time::timer::next_expiry() == clock::duration{20});
+    advance_time(20);
+    REQUIRE(periodic == 10000 / 30 + 1);
+}
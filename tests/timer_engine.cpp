@@ -0,0 +1,284 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <chrono>
+#include <vector>
+
+#include <elib/time/system_clock.h>
+#include "time/timer_engine.h"
+
+using namespace std::chrono;
+using elib::time::config::timer_backend;
+using elib::time::config::timer_catch_up;
+
+namespace
+{
+  template<timer_backend Backend, timer_catch_up CatchUp = timer_catch_up::skip, bool FireAllDue = false>
+  struct engine_fixture
+  {
+    static constexpr std::size_t capacity = 16;
+    static constexpr timer_catch_up catch_up = CatchUp;
+    using engine_type = elib::time::detail::timer_engine<Backend, capacity, CatchUp, FireAllDue>;
+
+    engine_fixture()
+    {
+      elib::time::system_clock::reset();
+    }
+
+    // advance the clock tick by tick, processing until every due timer fired
+    void advance(std::size_t ticks)
+    {
+      for (std::size_t tick = 0; tick < ticks; ++tick)
+      {
+        elib::time::system_clock::increment();
+
+        for (std::size_t i = 0; i < capacity; ++i)
+          engine.process_timers();
+      }
+    }
+
+    engine_type engine{};
+  };
+
+  using linear_fixture = engine_fixture<timer_backend::linear_scan>;
+  using heap_fixture = engine_fixture<timer_backend::min_heap>;
+  using linear_all_fixture = engine_fixture<timer_backend::linear_scan, timer_catch_up::skip, true>;
+
+  using linear_once_fixture = engine_fixture<timer_backend::linear_scan, timer_catch_up::fire_once>;
+  using linear_catch_up_fixture = engine_fixture<timer_backend::linear_scan, timer_catch_up::fire_all>;
+  using heap_once_fixture = engine_fixture<timer_backend::min_heap, timer_catch_up::fire_once>;
+  using heap_catch_up_fixture = engine_fixture<timer_backend::min_heap, timer_catch_up::fire_all>;
+}
+
+TEMPLATE_TEST_CASE("elib::time::detail::timer_engine: Common behaviour", "[time][timer]", linear_fixture, heap_fixture)
+{
+  TestType fixture;
+  auto& engine = fixture.engine;
+
+  SECTION("Periodic timer")
+  {
+    int counter = 0;
+    const auto id = engine.register_timer(milliseconds{10}, [&] { counter++; }, false);
+    REQUIRE(engine.valid(id));
+
+    fixture.advance(10);
+    REQUIRE(counter == 0); // not started
+
+    engine.start(id);
+    fixture.advance(9);
+    REQUIRE(counter == 0);
+    fixture.advance(1);
+    REQUIRE(counter == 1);
+    fixture.advance(20);
+    REQUIRE(counter == 3);
+
+    engine.stop(id);
+    fixture.advance(20);
+    REQUIRE(counter == 3);
+  }
+
+  SECTION("Single-shot timer runs from registration")
+  {
+    fixture.advance(5);
+
+    int counter = 0;
+    const auto id = engine.register_timer(milliseconds{10}, [&] { counter++; }, true);
+
+    fixture.advance(9);
+    REQUIRE(counter == 0);
+    fixture.advance(1);
+    REQUIRE(counter == 1);
+    fixture.advance(30);
+    REQUIRE(counter == 1);
+    REQUIRE_FALSE(engine.valid(id));
+  }
+
+  SECTION("Interval change keeps the start point")
+  {
+    int counter = 0;
+    const auto id = engine.register_timer(milliseconds{50}, [&] { counter++; }, false);
+    engine.start(id);
+
+    fixture.advance(20);
+    engine.set_interval(id, milliseconds{30});
+    REQUIRE(engine.interval(id) == milliseconds{30});
+
+    fixture.advance(9);
+    REQUIRE(counter == 0);
+    fixture.advance(1);
+    REQUIRE(counter == 1);
+  }
+
+  SECTION("Next expiry")
+  {
+    using clock = elib::time::system_clock;
+
+    REQUIRE(engine.next_expiry() == clock::duration::max());
+
+    const auto id = engine.register_timer(milliseconds{25}, [] {}, false);
+    engine.start(id);
+    engine.start(engine.register_timer(milliseconds{70}, [] {}, false));
+    REQUIRE(engine.next_expiry() == clock::duration{25});
+
+    elib::time::system_clock::set(20);
+    REQUIRE(engine.next_expiry() == clock::duration{5});
+
+    elib::time::system_clock::set(30);
+    REQUIRE(engine.next_expiry() == clock::duration::zero());
+
+    engine.stop(id);
+    REQUIRE(engine.next_expiry() == clock::duration{40});
+  }
+
+  SECTION("Unregistered timer never fires")
+  {
+    int counter = 0;
+    const auto id = engine.register_timer(milliseconds{10}, [&] { counter++; }, false);
+    engine.start(id);
+    engine.unregister_timer(id);
+
+    fixture.advance(20);
+    REQUIRE(counter == 0);
+    REQUIRE_FALSE(engine.valid(id));
+  }
+}
+
+TEST_CASE("elib::time::detail::timer_engine: min_heap keeps deadline order", "[time][timer]")
+{
+  heap_fixture fixture;
+  auto& engine = fixture.engine;
+
+  std::vector<int> order;
+  const int intervals[] = {70, 20, 50, 10, 60, 30, 40};
+  std::vector<elib::time::timer::id_type> ids;
+
+  for (int interval : intervals)
+  {
+    ids.push_back(engine.register_timer(milliseconds{interval}, [&order, interval] { order.push_back(interval); }, true));
+  }
+
+  // drop one from the middle of the heap
+  engine.unregister_timer(ids[2]);
+
+  for (int tick = 0; tick < 80; ++tick)
+  {
+    elib::time::system_clock::increment();
+    engine.process_timers();
+  }
+
+  REQUIRE(order == std::vector<int>{10, 20, 30, 40, 60, 70});
+}
+
+TEMPLATE_TEST_CASE("elib::time::detail::timer_engine: Across tick wraparound", "[time][timer]", linear_fixture, heap_fixture)
+{
+  TestType fixture;
+  auto& engine = fixture.engine;
+
+  using rep = elib::time::system_clock::rep;
+  elib::time::system_clock::set(std::numeric_limits<rep>::max() - 5);
+
+  int early = 0;
+  int late = 0;
+  engine.start(engine.register_timer(milliseconds{20}, [&] { late++; }, false));
+  engine.start(engine.register_timer(milliseconds{10}, [&] { early++; }, false));
+
+  fixture.advance(10);
+  REQUIRE(early == 1);
+  REQUIRE(late == 0);
+
+  fixture.advance(10);
+  REQUIRE(early == 2);
+  REQUIRE(late == 1);
+  REQUIRE(engine.next_expiry() == elib::time::system_clock::duration{10});
+}
+
+TEMPLATE_TEST_CASE("elib::time::detail::timer_engine: Fire all due timers in one pass", "[time][timer]", heap_fixture, linear_all_fixture)
+{
+  TestType fixture;
+  auto& engine = fixture.engine;
+
+  int counter = 0;
+  for (int i = 0; i < 8; ++i)
+    engine.start(engine.register_timer(milliseconds{10 + i}, [&] { counter++; }, false));
+
+  elib::time::system_clock::set(20);
+  engine.process_timers();
+  REQUIRE(counter == 8);
+
+  engine.process_timers();
+  REQUIRE(counter == 8);
+}
+
+TEMPLATE_TEST_CASE("elib::time::detail::timer_engine: Periodic catch-up after a stall", "[time][timer]",
+                   linear_fixture, heap_fixture, linear_once_fixture, heap_once_fixture,
+                   linear_catch_up_fixture, heap_catch_up_fixture)
+{
+  using clock = elib::time::system_clock;
+
+  TestType fixture;
+  auto& engine = fixture.engine;
+
+  int counter = 0;
+  engine.start(engine.register_timer(milliseconds{10}, [&] { counter++; }, false));
+
+  // deadlines 10..50 missed, processed at 53
+  clock::set(53);
+  engine.process_timers();
+
+  switch (TestType::catch_up)
+  {
+  case timer_catch_up::skip:
+    REQUIRE(counter == 1);
+    REQUIRE(engine.next_expiry() == clock::duration{7}); // original grid
+    break;
+
+  case timer_catch_up::fire_once:
+    REQUIRE(counter == 1);
+    REQUIRE(engine.next_expiry() == clock::duration{10}); // restarted at 53
+    break;
+
+  case timer_catch_up::fire_all:
+    REQUIRE(counter == 5);
+    REQUIRE(engine.next_expiry() == clock::duration{7});
+    break;
+  }
+}
+
+TEMPLATE_TEST_CASE("elib::time::detail::timer_engine: Periodic timers do not drift", "[time][timer]",
+                   linear_fixture, heap_fixture, linear_once_fixture, heap_once_fixture,
+                   linear_catch_up_fixture, heap_catch_up_fixture)
+{
+  using clock = elib::time::system_clock;
+
+  TestType fixture;
+  auto& engine = fixture.engine;
+
+  constexpr clock::rep period = 10;
+  constexpr clock::rep max_lag = period - 1;
+  constexpr std::size_t period_num = 100'000;
+
+  std::size_t fired = 0;
+  clock::rep max_jitter = 0;
+  bool on_time = true;
+
+  engine.start(engine.register_timer(milliseconds{period}, [&] {
+    fired++;
+
+    // jitter against the ideal grid, bounded by the dispatch lag if nothing accumulates
+    const clock::rep jitter = static_cast<clock::rep>(clock::ticks() - fired * period);
+    max_jitter = std::max(max_jitter, jitter);
+    on_time = on_time && jitter <= max_lag;
+  }, false));
+
+  // every period is dispatched with a pseudo-random lag of [0, max_lag] ticks
+  std::uint32_t seed = 12345;
+  for (std::size_t n = 1; n <= period_num; ++n)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    clock::set(static_cast<clock::rep>(n * period + (seed >> 16) % (max_lag + 1)));
+    engine.process_timers();
+  }
+
+  REQUIRE(fired == period_num);
+  REQUIRE(on_time);
+  REQUIRE(max_jitter <= max_lag);
+}
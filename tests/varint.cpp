@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <elib/varint.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace elib::data;
+
+namespace
+{
+  template<typename T>
+  void require_round_trip(T value)
+  {
+    // the fast path needs 8 readable bytes, exercise both paths
+    std::array<std::uint8_t, varint_max_size<std::uint64_t>> bytes{};
+    const std::size_t size = varint_encode(bytes.data(), value);
+
+    REQUIRE(size == varint_size(value));
+    REQUIRE(size <= varint_max_size<T>);
+
+    T padded{};
+    REQUIRE(varint_decode(bytes.data(), bytes.size(), padded) == size);
+    REQUIRE(padded == value);
+
+    T exact{};
+    REQUIRE(varint_decode(bytes.data(), size, exact) == size);
+    REQUIRE(exact == value);
+  }
+
+  template<typename T>
+  void require_round_trips()
+  {
+    using limits = std::numeric_limits<T>;
+
+    require_round_trip<T>(0);
+    require_round_trip<T>(1);
+    require_round_trip(limits::max());
+    require_round_trip(limits::min());
+
+    for (int bit = 0; bit < limits::digits; ++bit)
+    {
+      const T power = static_cast<T>(T{1} << bit);
+      require_round_trip(power);
+      require_round_trip(static_cast<T>(power - 1));
+      if constexpr (std::is_signed_v<T>)
+        require_round_trip(static_cast<T>(-power));
+    }
+  }
+}
+
+TEST_CASE("elib::data::varint: known encodings", "[data][varint]") {
+    std::array<std::uint8_t, 10> bytes{};
+
+    REQUIRE(varint_encode(bytes.data(), std::uint32_t{1}) == 1);
+    REQUIRE(bytes[0] == 0x01);
+
+    REQUIRE(varint_encode(bytes.data(), std::uint32_t{300}) == 2);
+    REQUIRE(bytes[0] == 0xAC);
+    REQUIRE(bytes[1] == 0x02);
+
+    REQUIRE(varint_encode(bytes.data(), std::uint32_t{0xFFFFFFFF}) == 5);
+    REQUIRE(bytes[4] == 0x0F);
+
+    REQUIRE(varint_encode(bytes.data(), std::numeric_limits<std::uint64_t>::max()) == 10);
+    REQUIRE(bytes[9] == 0x01);
+
+    // zig-zag
+    REQUIRE(zigzag_encode(std::int32_t{0}) == 0u);
+    REQUIRE(zigzag_encode(std::int32_t{-1}) == 1u);
+    REQUIRE(zigzag_encode(std::int32_t{1}) == 2u);
+    REQUIRE(zigzag_encode(std::int32_t{-2}) == 3u);
+    REQUIRE(zigzag_encode(std::numeric_limits<std::int32_t>::min()) == 0xFFFFFFFFu);
+    REQUIRE(zigzag_decode<std::int32_t>(0xFFFFFFFEu) == std::numeric_limits<std::int32_t>::max());
+
+    REQUIRE(varint_size(std::int64_t{-64}) == 1);
+    REQUIRE(varint_size(std::int64_t{64}) == 2);
+}
+
+TEST_CASE("elib::data::varint: round trips", "[data][varint]") {
+    require_round_trips<std::uint8_t>();
+    require_round_trips<std::int8_t>();
+    require_round_trips<std::uint16_t>();
+    require_round_trips<std::int16_t>();
+    require_round_trips<std::uint32_t>();
+    require_round_trips<std::int32_t>();
+    require_round_trips<std::uint64_t>();
+    require_round_trips<std::int64_t>();
+}
+
+TEST_CASE("elib::data::varint: malformed input", "[data][varint]") {
+    std::uint32_t value = 7;
+
+    SECTION("Truncated")
+    {
+        const std::array<std::uint8_t, 2> bytes{0x80, 0x80};
+        REQUIRE(varint_decode(bytes.data(), bytes.size(), value) == 0);
+        REQUIRE(varint_decode(bytes.data(), 0, value) == 0);
+    }
+
+    SECTION("Longer than the maximal size")
+    {
+        const std::array<std::uint8_t, 8> bytes{0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0, 0};
+        REQUIRE(varint_decode(bytes.data(), bytes.size(), value) == 0);
+        REQUIRE(varint_decode(bytes.data(), 6, value) == 0);
+    }
+
+    SECTION("Value out of range")
+    {
+        const std::array<std::uint8_t, 8> bytes{0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0, 0, 0}; // 2^33 - 1
+        REQUIRE(varint_decode(bytes.data(), bytes.size(), value) == 0);
+        REQUIRE(varint_decode(bytes.data(), 5, value) == 0);
+    }
+
+    SECTION("64-bit value out of range")
+    {
+        std::array<std::uint8_t, 10> bytes{};
+        bytes.fill(0xFF);
+        bytes[9] = 0x02; // bit 64
+
+        std::uint64_t wide{};
+        REQUIRE(varint_decode(bytes.data(), bytes.size(), wide) == 0);
+
+        std::array<std::uint8_t, 11> longer{};
+        longer.fill(0x80);
+        longer[10] = 0x00;
+        REQUIRE(varint_decode(longer.data(), longer.size(), wide) == 0);
+    }
+
+    REQUIRE(value == 7);
+}
+
+TEST_CASE("elib::data::varint: streams of values", "[data][varint]") {
+    std::vector<std::int64_t> values;
+    for (std::int64_t value = 1; value > 0 && value < std::numeric_limits<std::int64_t>::max() / 3; value *= 3)
+    {
+        values.push_back(value);
+        values.push_back(-value);
+    }
+
+    std::vector<std::uint8_t> bytes(values.size() * varint_max_size<std::int64_t>);
+    std::size_t size = 0;
+    for (const auto value : values)
+        size += varint_encode(bytes.data() + size, value);
+
+    std::size_t pos = 0;
+    for (const auto expected : values)
+    {
+        std::int64_t value{};
+        const std::size_t used = varint_decode(bytes.data() + pos, size - pos, value);
+
+        REQUIRE(used);
+        REQUIRE(value == expected);
+        pos += used;
+    }
+
+    REQUIRE(pos == size);
+}